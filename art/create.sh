@@ -29,7 +29,14 @@ python3 "$TOOLS_DIR/tilemap_grid.py" "$ART_DIR/spriteset.png" "$ART_DIR/spritese
 
 # Create header files
 python3 "$TOOLS_DIR/tiles_to_header.py" "$ART_DIR/tileset.png" tile 7
-python3 "$TOOLS_DIR/tiles_to_header.py" "$ART_DIR/spriteset.png" sprite 2
+python3 "$TOOLS_DIR/tiles_to_header.py" "$ART_DIR/spriteset.png" sprite4 2 44
+
+# Enemy flight paths
+python3 "$TOOLS_DIR/bake_paths.py" "$ART_DIR/paths.txt" 46
+
+# Enemy behaviour scripts (after the paths, they use the path IDs)
+python3 "$TOOLS_DIR/compile_behaviours.py" "$ART_DIR/behaviours.txt"
 
 # Create mem bank for image(s)
-python3 "$TOOLS_DIR/png_to_asm.py" "$ART_DIR/border.png" 40 "$SRC_DIR/border_data.asm"
\ No newline at end of file
+python3 "$TOOLS_DIR/png_to_asm.py" "$ART_DIR/border.png" 40 "$SRC_DIR/border_blocks.asm" --blocks
+python3 "$TOOLS_DIR/png_to_asm.py" "$ART_DIR/border.png" 42 "$SRC_DIR/layer2_background_lz.asm" --background --lz
\ No newline at end of file
@@ -14,31 +14,31 @@
 
 static const LevelSegment level1_segments[] = {
     // Section 1: Introduction
-    { 30, SEGMENT_CONFIG(LANE_CENTER, 4), 0, 0 },
+    { 30, SEGMENT_CONFIG(LANE_CENTER, 4), 1, 0 },   // 1 object at idx 0
 
     // Section 2: First split
-    { 4,  SEGMENT_CONFIG(LANE_BOTH, 4),   0, 0 },   // transition
-    { 40, SEGMENT_CONFIG(LANE_BOTH, 3),   2, 0 },   // 2 objects at idx 0
+    { 4,  SEGMENT_CONFIG(LANE_BOTH, 4),   0, 1 },   // transition
+    { 40, SEGMENT_CONFIG(LANE_BOTH, 3),   2, 1 },   // 2 objects at idx 1
 
     // Section 3: Right lane only
-    { 4,  SEGMENT_CONFIG(LANE_BOTH, 3),   0, 2 },   // transition
-    { 30, SEGMENT_CONFIG(LANE_RIGHT, 3),  2, 2 },   // 2 objects at idx 2
+    { 4,  SEGMENT_CONFIG(LANE_BOTH, 3),   0, 3 },   // transition
+    { 30, SEGMENT_CONFIG(LANE_RIGHT, 3),  3, 3 },   // 3 objects at idx 3
 
     // Section 4: Left lane only
-    { 4,  SEGMENT_CONFIG(LANE_BOTH, 3),   0, 4 },   // transition
-    { 35, SEGMENT_CONFIG(LANE_LEFT, 3),   2, 4 },   // 2 objects at idx 4
+    { 4,  SEGMENT_CONFIG(LANE_BOTH, 3),   0, 6 },   // transition
+    { 35, SEGMENT_CONFIG(LANE_LEFT, 3),   2, 6 },   // 2 objects at idx 6
 
     // Section 5: Both lanes with more obstacles
-    { 4,  SEGMENT_CONFIG(LANE_BOTH, 3),   0, 6 },   // transition
-    { 50, SEGMENT_CONFIG(LANE_BOTH, 3),   5, 6 },   // 5 objects at idx 6
+    { 4,  SEGMENT_CONFIG(LANE_BOTH, 3),   0, 8 },   // transition
+    { 50, SEGMENT_CONFIG(LANE_BOTH, 3),   7, 8 },   // 7 objects at idx 8
 
     // Section 6: Narrow finale
-    { 4,  SEGMENT_CONFIG(LANE_BOTH, 2),   0, 11 },  // transition
-    { 40, SEGMENT_CONFIG(LANE_CENTER, 2), 3, 11 },  // 3 objects at idx 11
+    { 4,  SEGMENT_CONFIG(LANE_BOTH, 2),   0, 15 },  // transition
+    { 40, SEGMENT_CONFIG(LANE_CENTER, 2), 3, 15 },  // 3 objects at idx 15
 
     // Section 7: Victory stretch
-    { 4,  SEGMENT_CONFIG(LANE_CENTER, 4), 0, 14 },
-    { 30, SEGMENT_CONFIG(LANE_CENTER, 4), 1, 14 },  // 1 object at idx 14
+    { 4,  SEGMENT_CONFIG(LANE_CENTER, 4), 0, 18 },
+    { 30, SEGMENT_CONFIG(LANE_CENTER, 4), 1, 18 },  // 1 object at idx 18
 
     // End marker
     { 0, 0, 0, 0 }
@@ -49,31 +49,37 @@ static const LevelSegment level1_segments[] = {
 // ============================================================================
 
 static const LevelObject level1_objects[] = {
-    // Section 2: First split (idx 0-1)
+    // Section 1: Introduction (idx 0)
+    { 20, OBJECT_DATA(OBJ_ENEMY_SPAWN, OBJ_LANE_CENTER, SPAWN_GROUP) },
+
+    // Section 2: First split (idx 1-2)
     { 15, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_LEFT, SIZE_PARTIAL) },
     { 25, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_RIGHT, SIZE_PARTIAL) },
 
-    // Section 3: Right lane (idx 2-3)
+    // Section 3: Right lane (idx 3-5)
+    { 5,  OBJECT_DATA(OBJ_ENEMY_SPAWN, OBJ_LANE_RIGHT, SPAWN_ARROW) },
     { 10, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_RIGHT, SIZE_SMALL) },
     { 20, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_RIGHT, SIZE_PARTIAL) },
 
-    // Section 4: Left lane (idx 4-5)
+    // Section 4: Left lane (idx 6-7)
     { 12, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_LEFT, SIZE_PARTIAL) },
     { 25, OBJECT_DATA(OBJ_LASER, OBJ_LANE_LEFT, 0) },
 
-    // Section 5: Both lanes (idx 6-10)
+    // Section 5: Both lanes (idx 8-14)
+    { 4,  OBJECT_DATA(OBJ_ENEMY_SPAWN, OBJ_LANE_CENTER, SPAWN_DIVE) },
     { 8,  OBJECT_DATA(OBJ_HOLE, OBJ_LANE_LEFT, SIZE_PARTIAL) },
     { 16, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_RIGHT, SIZE_PARTIAL) },
     { 24, OBJECT_DATA(OBJ_LASER, OBJ_LANE_LEFT, 0) },
+    { 28, OBJECT_DATA(OBJ_ENEMY_SPAWN, OBJ_LANE_CENTER, SPAWN_LOOP) },
     { 32, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_RIGHT, SIZE_PARTIAL) },
     { 40, OBJECT_DATA(OBJ_LASER, OBJ_LANE_RIGHT, 0) },
 
-    // Section 6: Narrow finale (idx 11-13)
+    // Section 6: Narrow finale (idx 15-17)
     { 10, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_CENTER, SIZE_SMALL) },
     { 20, OBJECT_DATA(OBJ_HOLE, OBJ_LANE_CENTER, SIZE_SMALL) },
     { 30, OBJECT_DATA(OBJ_LASER, OBJ_LANE_CENTER, 0) },
 
-    // Section 7: Victory stretch (idx 14)
+    // Section 7: Victory stretch (idx 18)
     { 15, OBJECT_DATA(OBJ_POWERUP, OBJ_LANE_CENTER, 0) },
 };
 
@@ -84,7 +90,7 @@ static const LevelObject level1_objects[] = {
 static const LevelDef level1_def = {
     "LEVEL 1",
     13,                     // segment_count (excluding end marker)
-    15,                     // object_count
+    19,                     // object_count
     level1_segments,
     level1_objects
 };
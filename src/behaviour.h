@@ -0,0 +1,33 @@
+#ifndef BEHAVIOUR_H
+#define BEHAVIOUR_H
+
+// Enemy behaviour bytecode
+// Scripts are written in art/behaviours.txt and compiled offline by
+// tools/compile_behaviours.py into behaviour_code.h (the compiler reads
+// the opcode values below). Each live enemy runs its script in
+// enemies_update; WAIT and PATH end the enemy's turn for the frame, and
+// at most SCRIPT_BUDGET instructions run per enemy per frame, so the
+// worst-case AI cost is bounded whatever the script does.
+//
+// Operands are single bytes; addr is a byte offset into the code.
+// Speeds are signed 1/16 pixels per frame. Scripts are written for
+// enemies entering from the left; for enemies entering from the right
+// MOVE vx and IFLEFT are mirrored, so they fly the mirror image.
+
+#define SCRIPT_BUDGET  8      // Instructions per enemy per frame
+#define SCRIPT_END     0xFF   // pc of a finished script
+
+#define OP_END      0x00  //            stop the script (velocity is kept)
+#define OP_MOVE     0x01  // vx vy      set velocity (descent gets the level bonus)
+#define OP_WAIT     0x02  // n          do nothing for n frames
+#define OP_PATH     0x03  // id         fly a baked path, continue when it ends
+#define OP_JUMP     0x04  // addr       continue at addr
+#define OP_LOOP     0x05  // n          set the loop counter
+#define OP_NEXT     0x06  // addr       decrement the loop counter, jump if not zero
+#define OP_FIRE     0x07  //            fire at the player
+#define OP_IFLEFT   0x08  // addr       jump if the player is left of the enemy
+#define OP_IFNEAR   0x09  // d addr     jump if the player is within d pixels horizontally
+#define OP_BOUNCE   0x0A  //            reverse vx at the game area edges (and group followers)
+#define OP_SEEK     0x0B  // s          vx toward the player at speed s
+
+#endif // BEHAVIOUR_H
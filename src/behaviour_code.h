@@ -0,0 +1,56 @@
+#ifndef BEHAVIOUR_CODE_H
+#define BEHAVIOUR_CODE_H
+
+#include <stdint.h>
+#include "behaviour.h"
+
+// Enemy behaviour bytecode (generated by tools/compile_behaviours.py
+// from art/behaviours.txt)
+
+// Script entry points
+#define BEHAVIOUR_PATROL 0
+#define BEHAVIOUR_WING 8
+#define BEHAVIOUR_WEAVE 13
+#define BEHAVIOUR_DIVE 17
+#define BEHAVIOUR_LOOP 41
+
+static const uint8_t behaviour_code[53] = {
+    // behaviour patrol
+    0x01, 0x08, 0x10,       //   0: move 8 16
+    // patrol_loop:
+    0x0a,                   //   3: bounce
+    0x02, 0x01,             //   4: wait 1
+    0x04, 0x03,             //   6: jump patrol_loop
+    // behaviour wing
+    0x01, 0x08, 0x10,       //   8: move 8 16
+    0x04, 0x03,             //  11: jump patrol_loop
+    // behaviour weave
+    0x03, 0x01,             //  13: path weave
+    0x04, 0x00,             //  15: jump patrol
+    // behaviour dive
+    0x03, 0x00,             //  17: path dive
+    0x07,                   //  19: fire
+    0x01, 0x00, 0x18,       //  20: move 0 24
+    // dive_seek:
+    0x0b, 0x0c,             //  23: seek 12
+    0x02, 0x04,             //  25: wait 4
+    0x09, 0x18, 0x20,       //  27: ifnear 24 dive_fire
+    0x04, 0x17,             //  30: jump dive_seek
+    // dive_fire:
+    0x05, 0x03,             //  32: loop 3
+    // dive_burst:
+    0x07,                   //  34: fire
+    0x02, 0x08,             //  35: wait 8
+    0x06, 0x22,             //  37: next dive_burst
+    0x04, 0x17,             //  39: jump dive_seek
+    // behaviour loop
+    0x03, 0x02,             //  41: path loop
+    0x08, 0x31,             //  43: ifleft loop_right
+    0x01, 0xf4, 0x14,       //  45: move -12 20
+    0x00,                   //  48: end
+    // loop_right:
+    0x01, 0x0c, 0x14,       //  49: move 12 20
+    0x00,                   //  52: end
+};
+
+#endif
@@ -2,73 +2,80 @@
 #include "bullet.h"
 #include "sprites.h"
 
-// Global bullets array
-Entity bullets[MAX_BULLETS];
+// Global bullet pool
+Bullets bullets;
+
+// Sprite slot per bullet (allocated while the bullet is live)
+static uint8_t bullet_sprite[MAX_BULLETS];
 
 // Initialize bullets (clear all)
 void bullets_init(void) {
-    uint8_t i;
-    for (i = 0; i < MAX_BULLETS; i++) {
-        bullets[i].active = 0;
+    uint8_t n;
+
+    // Release slots left from the previous game
+    for (n = 0; n < bullets.pool.count; n++) {
+        sprite_free(bullet_sprite[bullets.pool.live[n]], 1);
     }
+    pool_init(&bullets.pool, MAX_BULLETS);
+}
+
+// Remove a live bullet and release its sprite slot
+void bullet_kill(uint8_t id) {
+    sprite_free(bullet_sprite[id], 1);
+    pool_release(&bullets.pool, id);
 }
 
 // Update bullet positions
 void bullets_update(void) {
-    uint8_t i;
+    uint8_t n, i;
 
-    for (i = 0; i < MAX_BULLETS; i++) {
-        if (bullets[i].active) {
-            bullets[i].y += bullets[i].dy;
+    for (n = bullets.pool.count; n-- > 0;) {
+        i = bullets.pool.live[n];
+        FIX_INTEGRATE(bullets.y[i], bullets.yf[i], bullets.vy[i]);
 
-            // Deactivate if off screen (top)
-            if (bullets[i].y < -BULLET_HEIGHT) {
-                bullets[i].active = 0;
-            }
+        // Remove if off screen (top)
+        if (bullets.y[i] < -BULLET_HEIGHT) {
+            bullet_kill(i);
         }
     }
 }
 
 // Spawn a bullet from player position
 void bullets_spawn(int16_t player_x, int16_t player_y) {
-    uint8_t i;
+    uint8_t i = pool_alloc(&bullets.pool);
 
-    // Find inactive bullet slot
-    for (i = 0; i < MAX_BULLETS; i++) {
-        if (!bullets[i].active) {
-            bullets[i].active = 1;
-            // Bullet sprite is 16x16, center it on player center
-            bullets[i].x = player_x + (PLAYER_WIDTH / 2) - 8;
-            bullets[i].y = player_y - 16;
-            bullets[i].dx = 0;
-            bullets[i].dy = -BULLET_SPEED;  // Move upward
-            break;
-        }
-    }
+    if (i == POOL_NONE) return;
+
+    // Bullet sprite is 16x16, center it on player center
+    bullets.x[i] = player_x + (PLAYER_WIDTH / 2) - 8;
+    bullets.y[i] = player_y - 16;
+    bullets.yf[i] = 0;
+    bullets.vy[i] = -BULLET_SPEED;  // Move upward
+    bullet_sprite[i] = SPRITE_SLOT_NONE;
 }
 
 // Render bullets using sprites
-// Returns next available sprite slot
-uint8_t bullets_render(uint8_t sprite_slot) {
-    uint8_t i;
+// Live bullets get a slot on first render; bullet_kill releases it
+void bullets_render(void) {
+    uint8_t n, i;
 
-    for (i = 0; i < MAX_BULLETS; i++) {
-        if (bullets[i].active) {
-            sprite_set(sprite_slot++, bullets[i].x, bullets[i].y, SPRITE_BULLET);
+    for (n = 0; n < bullets.pool.count; n++) {
+        i = bullets.pool.live[n];
+        if (bullet_sprite[i] == SPRITE_SLOT_NONE) {
+            bullet_sprite[i] = sprite_alloc(SPRITE_BAND_AIR, 1);
+            if (bullet_sprite[i] == SPRITE_SLOT_NONE) continue;
         }
+        sprite_set(bullet_sprite[i], bullets.x[i], bullets.y[i], SPRITE_BULLET);
     }
-
-    return sprite_slot;
 }
 
-// Hide all bullet sprites
-// Returns next available sprite slot
-uint8_t bullets_hide(uint8_t sprite_slot) {
-    uint8_t i;
+// Hide all bullet sprites (releases their slots)
+void bullets_hide(void) {
+    uint8_t n, i;
 
-    for (i = 0; i < MAX_BULLETS; i++) {
-        sprite_hide(sprite_slot++);
+    for (n = 0; n < bullets.pool.count; n++) {
+        i = bullets.pool.live[n];
+        sprite_free(bullet_sprite[i], 1);
+        bullet_sprite[i] = SPRITE_SLOT_NONE;
     }
-
-    return sprite_slot;
 }
@@ -3,6 +3,17 @@
 
 #include <stdint.h>
 #include "game.h"
+#include "pool.h"
+
+// Bullet storage: one array per field, indexed by bullet id
+// Live ids are listed in pool.live[0..pool.count-1]
+typedef struct {
+    Pool pool;
+    int16_t x[MAX_BULLETS];
+    int16_t y[MAX_BULLETS];
+    uint8_t yf[MAX_BULLETS];    // 8.8 fraction of y
+    int16_t vy[MAX_BULLETS];    // 8.8 velocity
+} Bullets;
 
 // Initialize bullets (clear all)
 void bullets_init(void);
@@ -13,15 +24,16 @@ void bullets_update(void);
 // Spawn a bullet from player position
 void bullets_spawn(int16_t player_x, int16_t player_y);
 
-// Render bullets using sprites
-// Returns next available sprite slot
-uint8_t bullets_render(uint8_t sprite_slot);
+// Remove a live bullet and release its sprite slot
+void bullet_kill(uint8_t id);
 
-// Hide all bullet sprites
-// Returns next available sprite slot
-uint8_t bullets_hide(uint8_t sprite_slot);
+// Render bullets using sprites (slots allocated per active bullet)
+void bullets_render(void);
 
-// Global bullets array
-extern Entity bullets[MAX_BULLETS];
+// Hide all bullet sprites and release their slots
+void bullets_hide(void);
+
+// Global bullet pool
+extern Bullets bullets;
 
 #endif // BULLET_H
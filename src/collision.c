@@ -2,8 +2,10 @@
 #include "collision.h"
 #include "bullet.h"
 #include "enemy.h"
+#include "shot.h"
 #include "player.h"
 #include "level.h"
+#include "effects.h"
 
 // Tilemap constants for reading tile data
 #define TILEMAP_ADDR    0x6000
@@ -23,24 +25,29 @@ static uint8_t check_aabb(int16_t x1, int16_t y1, uint8_t w1, uint8_t h1,
 // Check bullet vs enemy collisions
 CollisionResult collision_bullets_enemies(void) {
     CollisionResult result = {0, 0, 0, CRASH_NONE};
-    uint8_t i, j;
+    uint8_t n, m, i, j;
 
-    for (i = 0; i < MAX_BULLETS; i++) {
-        if (!bullets[i].active) continue;
+    // Live lists are walked backwards so kills don't skip entries
+    for (n = bullets.pool.count; n-- > 0;) {
+        i = bullets.pool.live[n];
 
-        for (j = 0; j < MAX_ENEMIES; j++) {
-            if (!enemies[j].active) continue;
+        for (m = enemies.pool.count; m-- > 0;) {
+            j = enemies.pool.live[m];
 
-            if (check_aabb(bullets[i].x, bullets[i].y, BULLET_WIDTH, BULLET_HEIGHT,
-                           enemies[j].x, enemies[j].y, ENEMY_WIDTH, ENEMY_HEIGHT)) {
-                bullets[i].active = 0;
-                enemies[j].health--;
+            if (check_aabb(bullets.x[i], bullets.y[i], BULLET_WIDTH, BULLET_HEIGHT,
+                           enemies.x[j], enemies.y[j], ENEMY_WIDTH, ENEMY_HEIGHT)) {
+                bullet_kill(i);
+                enemies.health[j]--;
 
-                if (enemies[j].health <= 0) {
-                    enemies[j].active = 0;
+                if (enemies.health[j] == 0) {
+                    effects_spawn(EFFECT_EXPLOSION, enemies.x[j] + ENEMY_WIDTH / 2,
+                                  enemies.y[j] + ENEMY_HEIGHT / 2);
+                    effects_debris(enemies.x[j] + ENEMY_WIDTH / 2,
+                                   enemies.y[j] + ENEMY_HEIGHT / 2);
                     result.enemies_killed++;
                     // Score based on enemy type
-                    result.score_gained += (enemies[j].type == 0) ? SCORE_ENEMY_NORMAL : SCORE_ENEMY_FAST;
+                    result.score_gained += (enemies.type[j] == 0) ? SCORE_ENEMY_NORMAL : SCORE_ENEMY_FAST;
+                    enemy_kill(j);
                 }
                 break;
             }
@@ -52,21 +59,23 @@ CollisionResult collision_bullets_enemies(void) {
 
 // Check player vs enemy collisions
 uint8_t collision_player_enemies(void) {
-    uint8_t i;
+    uint8_t n, i;
 
     // Skip if player is invincible
     if (player.invincible != 0) {
         return CRASH_NONE;
     }
 
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        if (!enemies[i].active) continue;
+    for (n = 0; n < enemies.pool.count; n++) {
+        i = enemies.pool.live[n];
 
         if (check_aabb(player.x, player.y, PLAYER_WIDTH, PLAYER_HEIGHT,
-                       enemies[i].x, enemies[i].y, ENEMY_WIDTH, ENEMY_HEIGHT)) {
+                       enemies.x[i], enemies.y[i], ENEMY_WIDTH, ENEMY_HEIGHT)) {
             // Return crash type based on enemy type (yellow=normal, red=fast)
-            uint8_t crash = (enemies[i].type == 0) ? CRASH_ENEMY : CRASH_ENEMY_FAST;
-            enemies[i].active = 0;
+            uint8_t crash = (enemies.type[i] == 0) ? CRASH_ENEMY : CRASH_ENEMY_FAST;
+            effects_spawn(EFFECT_SHOCKWAVE, enemies.x[i] + ENEMY_WIDTH / 2,
+                          enemies.y[i] + ENEMY_HEIGHT / 2);
+            enemy_kill(i);
             return crash;
         }
     }
@@ -74,6 +83,38 @@ uint8_t collision_player_enemies(void) {
     return CRASH_NONE;
 }
 
+// Check player vs enemy shots
+// Broadphase: the player's box covers at most two SHOT_ROW bands, and
+// only shots in those bands get the box test. The box test compares
+// unsigned offsets, so each axis is a single compare.
+uint8_t collision_player_shots(void) {
+    uint8_t n, i, rows;
+    int16_t left, top;
+
+    if (player.invincible != 0) {
+        return CRASH_NONE;
+    }
+
+    // Player box grown by half a shot on each side, tested against centres
+    left = player.x - (SHOT_SIZE / 2);
+    top = player.y - (SHOT_SIZE / 2);
+    rows = SHOT_ROW(top) | SHOT_ROW(top + PLAYER_HEIGHT + SHOT_SIZE - 1);
+
+    for (n = shots.pool.count; n-- > 0;) {
+        i = shots.pool.live[n];
+        if (!(shots.row[i] & rows)) continue;
+
+        if ((uint16_t)(shots.x[i] - left) < PLAYER_WIDTH + SHOT_SIZE &&
+            (uint16_t)(shots.y[i] - top) < PLAYER_HEIGHT + SHOT_SIZE) {
+            effects_spawn(EFFECT_SHOCKWAVE, shots.x[i], shots.y[i]);
+            shot_kill(i);
+            return CRASH_SHOT;
+        }
+    }
+
+    return CRASH_NONE;
+}
+
 // Check if player is over a hole
 uint8_t collision_check_hole(int16_t player_x, int16_t player_y, int16_t scroll_y) {
     int16_t player_center_x = player_x + (PLAYER_WIDTH / 2);
@@ -21,6 +21,10 @@ CollisionResult collision_bullets_enemies(void);
 // Returns crash type if collision occurred, CRASH_NONE otherwise
 uint8_t collision_player_enemies(void);
 
+// Check player vs enemy shot collisions
+// Returns CRASH_SHOT if a shot hit the player, CRASH_NONE otherwise
+uint8_t collision_player_shots(void);
+
 // Check if player is over a hole
 // Returns 1 if player center is over a hole, 0 otherwise
 uint8_t collision_check_hole(int16_t player_x, int16_t player_y, int16_t scroll_y);
@@ -0,0 +1,85 @@
+#include <arch/zxn.h>
+#include <stdint.h>
+#include "copper.h"
+
+// Copper registers
+#define COPPER_DATA_REG      0x60    // Data, auto-increments the address
+#define COPPER_ADDR_LO_REG   0x61    // Address bits 7-0
+#define COPPER_CTRL_REG      0x62    // Bits 7-6 mode, bits 2-0 address bits 10-8
+
+// Control modes (bits 7-6 of register 0x62)
+#define COPPER_STOP          0x00
+#define COPPER_RUN_FRAME     0xC0    // Restart from address 0 every frame
+
+// Instructions are 16 bits, written high byte first
+// WAIT: 1hhhhhhv vvvvvvvv (h = horizontal position / 8, v = line)
+// MOVE: 0rrrrrrr dddddddd (r = next register, d = value)
+#define COPPER_WAIT_HI(line)  (0x80 | ((line) >> 8))
+#define COPPER_HALT           0xFF   // WAIT for line 511: never reached
+
+// Each band is WAIT + MOVE (4 bytes); the MOVE value is the last byte
+#define COPPER_BAND_SIZE      4
+#define COPPER_VALUE_OFFSET   3
+
+static uint16_t band_pos[COPPER_MAX_BANDS];
+static int16_t band_speed[COPPER_MAX_BANDS];
+static uint8_t band_count = 0;
+
+// Build the copper program and start it
+// Program: per band WAIT line / MOVE 0x17, then a halt. Only the MOVE
+// values change per frame, so the structure is written once here.
+void copper_parallax_init(const uint8_t *lines, const int16_t *speeds, uint8_t count) {
+    uint8_t i;
+
+    if (count > COPPER_MAX_BANDS) count = COPPER_MAX_BANDS;
+    band_count = count;
+
+    // Stop while rewriting, start at address 0
+    ZXN_NEXTREG(COPPER_CTRL_REG, COPPER_STOP);
+    ZXN_NEXTREG(COPPER_ADDR_LO_REG, 0);
+
+    IO_NEXTREG_REG = COPPER_DATA_REG;
+    for (i = 0; i < count; i++) {
+        band_pos[i] = 0;
+        band_speed[i] = speeds[i];
+
+        // WAIT for the band's first line, horizontal position 0
+        IO_NEXTREG_DAT = COPPER_WAIT_HI(lines[i]);
+        IO_NEXTREG_DAT = lines[i];
+
+        // MOVE Layer 2 Y scroll (value patched by copper_parallax_update)
+        IO_NEXTREG_DAT = 0x17;
+        IO_NEXTREG_DAT = 0;
+    }
+    IO_NEXTREG_DAT = COPPER_HALT;
+    IO_NEXTREG_DAT = COPPER_HALT;
+
+    ZXN_NEXTREG(COPPER_CTRL_REG, COPPER_RUN_FRAME);
+}
+
+// Advance every band and patch the scroll values in copper memory
+// Three register writes per band; rewriting the control register with
+// the same mode does not restart the copper.
+void copper_parallax_update(void) {
+    uint8_t i;
+    uint16_t addr = COPPER_VALUE_OFFSET;
+
+    for (i = 0; i < band_count; i++) {
+        band_pos[i] += band_speed[i];
+
+        IO_NEXTREG_REG = COPPER_ADDR_LO_REG;
+        IO_NEXTREG_DAT = (uint8_t)addr;
+        IO_NEXTREG_REG = COPPER_CTRL_REG;
+        IO_NEXTREG_DAT = COPPER_RUN_FRAME | (addr >> 8);
+        IO_NEXTREG_REG = COPPER_DATA_REG;
+        IO_NEXTREG_DAT = (uint8_t)(-(band_pos[i] >> 8));
+
+        addr += COPPER_BAND_SIZE;
+    }
+}
+
+// Stop the copper
+void copper_stop(void) {
+    ZXN_NEXTREG(COPPER_CTRL_REG, COPPER_STOP);
+    band_count = 0;
+}
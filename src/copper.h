@@ -0,0 +1,27 @@
+#ifndef COPPER_H
+#define COPPER_H
+
+#include <stdint.h>
+
+// Copper-driven parallax: the screen is split into horizontal bands and
+// the copper rewrites the Layer 2 Y scroll register (0x17) at the first
+// line of each band, so every band scrolls at its own speed.
+// Intended for Layer 2 wrap mode (L2_WRAP_STARS), where the scroll value
+// is a plain 8-bit offset into the 256 line buffer.
+
+#define COPPER_MAX_BANDS  8
+
+// Build the copper program and start it (restarts every frame)
+// lines: first screen line of each band (ascending, first should be 0)
+// speeds: pixels per frame in 8.8 fixed point, positive moves content down
+// Only needs calling again when the band layout or speeds change.
+void copper_parallax_init(const uint8_t *lines, const int16_t *speeds, uint8_t count);
+
+// Advance every band and patch the scroll values in copper memory
+// Call once per frame right after the vertical blank halt
+void copper_parallax_update(void);
+
+// Stop the copper (Layer 2 Y scroll is then whatever the CPU writes)
+void copper_stop(void);
+
+#endif // COPPER_H
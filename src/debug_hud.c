@@ -2,6 +2,7 @@
 #include "ula.h"
 #include "player.h"
 #include "tilemap.h"
+#include "director.h"
 
 // Debug HUD state
 static uint8_t debug_enabled = 0;
@@ -34,6 +35,7 @@ void debug_hud_clear(void) {
     ula_print_at(0, 16, "          ", 0x00);
     ula_print_at(0, 17, "          ", 0x00);
     ula_print_at(0, 18, "          ", 0x00);
+    ula_print_at(0, 19, "          ", 0x00);
     debug_visible = 0;
 }
 
@@ -64,6 +66,8 @@ void debug_hud_render(void) {
     ula_print_num(5, 17, tile, ATTR_YELLOW_ON_RED);
     ula_print_at(0, 18, "COL:      ", ATTR_WHITE_ON_RED);
     ula_print_num(4, 18, collision, ATTR_YELLOW_ON_RED);
+    ula_print_at(0, 19, "LINES:    ", ATTR_WHITE_ON_RED);
+    ula_print_num(6, 19, director_load(), ATTR_YELLOW_ON_RED);
 
     debug_visible = 1;
 }
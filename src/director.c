@@ -0,0 +1,121 @@
+#include <arch/zxn.h>
+#include <stdint.h>
+#include "director.h"
+#include "game.h"
+#include "enemy.h"
+#include "level.h"
+
+// Active video line registers
+#define VIDEO_LINE_MSB_REG  0x1E    // Bit 0 = line bit 8
+#define VIDEO_LINE_LSB_REG  0x1F
+
+// Difficulty curve, one step per level (the last step repeats)
+typedef struct {
+    uint8_t interval;   // Frames between timed waves
+    uint8_t max_size;   // Most enemies in one formation
+} WaveStep;
+
+#define WAVE_STEPS  8
+
+static const WaveStep wave_curve[WAVE_STEPS] = {
+    { 72, 2 }, { 64, 3 }, { 56, 3 }, { 50, 4 },
+    { 44, 4 }, { 40, 4 }, { 36, 4 }, { 32, 4 }
+};
+
+static uint8_t wave_timer;     // Frames until the next timed wave
+static uint16_t start_line;    // Raster line when the frame's work began
+static uint16_t peak_load;     // Decaying peak frame cost in lines
+
+// Read the raster line, again if the LSB wrapped between the two reads
+static uint16_t read_video_line(void) {
+    uint8_t hi, lo;
+
+    do {
+        IO_NEXTREG_REG = VIDEO_LINE_MSB_REG;
+        hi = IO_NEXTREG_DAT;
+        IO_NEXTREG_REG = VIDEO_LINE_LSB_REG;
+        lo = IO_NEXTREG_DAT;
+        IO_NEXTREG_REG = VIDEO_LINE_MSB_REG;
+    } while (IO_NEXTREG_DAT != hi);
+
+    return ((uint16_t)(hi & 0x01) << 8) | lo;
+}
+
+// Curve step for the current level
+static const WaveStep *wave_step(void) {
+    uint8_t level = game.level;
+
+    if (level == 0) level = 1;
+    if (level > WAVE_STEPS) level = WAVE_STEPS;
+    return &wave_curve[level - 1];
+}
+
+// Reset the wave timer and load
+void director_init(void) {
+    wave_timer = wave_step()->interval;
+    peak_load = 0;
+}
+
+// Note the raster line at the start of the frame's work
+void director_frame_start(void) {
+    start_line = read_video_line();
+}
+
+// Measure the frame's cost and update the peak load
+// The peak falls slowly, so one light frame does not release a wave
+// straight after a heavy one. A frame that overran the budget wraps to
+// a small cost; the held peak covers it.
+void director_frame_end(void) {
+    uint16_t line = read_video_line();
+    uint16_t cost;
+
+    if (line >= start_line) {
+        cost = line - start_line;
+    } else {
+        cost = line + DIRECTOR_FRAME_LINES - start_line;
+    }
+
+    peak_load = (peak_load > DIRECTOR_LOAD_DECAY) ? peak_load - DIRECTOR_LOAD_DECAY : 0;
+    if (cost > peak_load) peak_load = cost;
+}
+
+// Spawn the next formation if it is due and the frame has room
+// Scripted waves go first and restart the timer. While the load is over
+// DIRECTOR_DEFER_LINES nothing spawns (scripted waves stay queued in
+// the level); over DIRECTOR_THIN_LINES formations are capped.
+void director_update(void) {
+    const WaveStep *step = wave_step();
+    uint8_t variant, form, max_size;
+
+    if (wave_timer > 0) wave_timer--;
+
+    if (peak_load >= DIRECTOR_DEFER_LINES) return;
+
+    max_size = step->max_size;
+    if (peak_load >= DIRECTOR_THIN_LINES && max_size > DIRECTOR_THIN_SIZE) {
+        max_size = DIRECTOR_THIN_SIZE;
+    }
+
+    variant = level_take_spawn();
+    if (variant != LEVEL_SPAWN_NONE) {
+        form = (variant < NUM_FORMATION_TYPES) ? variant : FORMATION_RANDOM;
+    }
+    else if (wave_timer == 0) {
+        form = FORMATION_RANDOM;
+    }
+    else {
+        return;
+    }
+
+    enemies_spawn(game.level, form, max_size);
+    game.wave++;
+
+    // Half as many timed waves while the player is dying
+    wave_timer = step->interval;
+    if (game.state == STATE_DYING) wave_timer <<= 1;
+}
+
+// Peak frame cost in lines
+uint16_t director_load(void) {
+    return peak_load;
+}
@@ -0,0 +1,33 @@
+#ifndef DIRECTOR_H
+#define DIRECTOR_H
+
+#include <stdint.h>
+
+// Wave director: decides when enemy formations enter and how big they
+// are. Scripted waves come from the level's OBJ_ENEMY_SPAWN objects,
+// timed waves from a per-level difficulty curve. Both are held back or
+// made smaller while recent frames ran close to the frame budget.
+
+// Frame cost in raster lines (50Hz frame = 312 lines)
+#define DIRECTOR_FRAME_LINES  312
+#define DIRECTOR_THIN_LINES   232   // Above this, formations are capped
+#define DIRECTOR_DEFER_LINES  272   // Above this, no new formations
+#define DIRECTOR_THIN_SIZE    2     // Formation cap while thinning
+#define DIRECTOR_LOAD_DECAY   4     // Lines the peak load falls per frame
+
+// Reset the wave timer and load (call from game_init)
+void director_init(void);
+
+// Note the raster line at the start / end of the frame's game work
+// (call after the vblank wait and after the last per-frame job)
+void director_frame_start(void);
+void director_frame_end(void);
+
+// Spawn the next formation if it is due and the frame has room
+// The timed interval doubles while the player is dying.
+void director_update(void);
+
+// Peak frame cost in lines (debug HUD)
+uint16_t director_load(void);
+
+#endif // DIRECTOR_H
@@ -0,0 +1,206 @@
+#include <stdint.h>
+#include "effects.h"
+#include "sprites.h"
+#include "game.h"
+#include "rng.h"
+#include "overlay.h"
+#include "layer2.h"
+
+// Effect durations in frames
+#define EXPLOSION_FRAMES  16
+#define SHOCKWAVE_FRAMES  16
+#define WARP_FRAMES       16
+
+typedef struct {
+    int16_t x;        // Centre
+    int16_t y;
+    uint8_t type;
+    uint8_t frame;
+    uint8_t slot;     // Sprite slot (effects band)
+    uint8_t spin;     // Starting spin step, so explosions differ
+} Effect;
+
+static Effect effects[EFFECT_MAX];
+
+// Debris: 2x2 fragments drawn into Layer 2 through the overlay, so a
+// kill can throw more pieces than there are free sprite slots. While
+// Layer 2 is not direct (wrap mode, double buffered or a background job)
+// each piece borrows an effects band slot and shows the bullet pattern.
+#define DEBRIS_MAX     24
+#define DEBRIS_PIECES  6    // Fragments per kill
+#define DEBRIS_FRAMES  12
+#define DEBRIS_SIZE    2
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int8_t vx;        // Pixels per frame
+    int8_t vy;
+    uint8_t life;     // Frames left (0 = free)
+    uint8_t color;    // RGB332
+    uint8_t slot;     // Sprite slot while not direct, else SPRITE_SLOT_NONE
+} Debris;
+
+static Debris debris[DEBRIS_MAX];
+
+static const uint8_t debris_colors[4] = { COLOR_YELLOW, COLOR_ORANGE, COLOR_RED, COLOR_WHITE };
+
+// Hardware scale per 4-frame step (0 = 1x ... 3 = 8x)
+static const uint8_t explosion_scale[4] = { 0, 1, 1, 2 };
+static const uint8_t shockwave_scale[4] = { 0, 1, 2, 3 };
+static const uint8_t warp_scale[4] = { 3, 2, 1, 0 };
+
+// Mirror/rotate sequence that makes a single pattern appear to spin
+static const uint8_t spin_flags[4] = {
+    0, SPRITE_ROTATE, SPRITE_MIRROR_X | SPRITE_MIRROR_Y, SPRITE_ROTATE | SPRITE_MIRROR_X | SPRITE_MIRROR_Y
+};
+
+// Remove all effects and release their sprite slots
+void effects_init(void) {
+    uint8_t i;
+
+    for (i = 0; i < EFFECT_MAX; i++) {
+        if (effects[i].type != EFFECT_NONE) {
+            sprite_free(effects[i].slot, 1);
+            effects[i].type = EFFECT_NONE;
+        }
+    }
+    for (i = 0; i < DEBRIS_MAX; i++) {
+        if (debris[i].life != 0) {
+            sprite_free(debris[i].slot, 1);
+            debris[i].life = 0;
+        }
+    }
+}
+
+// Start an effect centred on x, y
+void effects_spawn(uint8_t type, int16_t x, int16_t y) {
+    uint8_t i;
+    uint8_t slot;
+
+    for (i = 0; i < EFFECT_MAX; i++) {
+        if (effects[i].type == EFFECT_NONE) {
+            slot = sprite_alloc(SPRITE_BAND_EFFECTS, 1);
+            if (slot == SPRITE_SLOT_NONE) return;
+
+            effects[i].x = x;
+            effects[i].y = y;
+            effects[i].type = type;
+            effects[i].frame = 0;
+            effects[i].slot = slot;
+            effects[i].spin = rng8(RNG_EFFECTS) & 0x03;
+            return;
+        }
+    }
+}
+
+// Throw debris out from x, y with random speeds (-2..2 pixels per frame)
+void effects_debris(int16_t x, int16_t y) {
+    uint8_t i;
+    uint8_t pieces = DEBRIS_PIECES;
+    uint8_t r;
+    Debris *d;
+
+    for (i = 0; i < DEBRIS_MAX && pieces > 0; i++) {
+        d = &debris[i];
+        if (d->life != 0) continue;
+
+        r = rng8(RNG_EFFECTS);
+        d->x = x;
+        d->y = y;
+        d->vx = (int8_t)(r % 5) - 2;
+        d->vy = (int8_t)((r >> 3) % 5) - 3;   // Mostly upwards, then falls
+        d->life = DEBRIS_FRAMES;
+        d->color = debris_colors[r >> 6];
+        d->slot = SPRITE_SLOT_NONE;
+        pieces--;
+    }
+}
+
+// Draw and advance debris (pieces fall by one more pixel every 4 frames)
+// Pieces move between the overlay and sprites when layer2_is_direct()
+// changes; without a free slot a piece is skipped for that frame.
+static void effects_render_debris(void) {
+    uint8_t i;
+    uint8_t direct = layer2_is_direct();
+    Debris *d;
+
+    for (i = 0; i < DEBRIS_MAX; i++) {
+        d = &debris[i];
+        if (d->life == 0) continue;
+
+        if (direct) {
+            if (d->slot != SPRITE_SLOT_NONE) {
+                sprite_free(d->slot, 1);
+                d->slot = SPRITE_SLOT_NONE;
+            }
+            overlay_fill(d->x, d->y, DEBRIS_SIZE, DEBRIS_SIZE, d->color);
+        }
+        else {
+            if (d->slot == SPRITE_SLOT_NONE) {
+                d->slot = sprite_alloc(SPRITE_BAND_EFFECTS, 1);
+            }
+            if (d->slot != SPRITE_SLOT_NONE) {
+                sprite_set_flags(d->slot, d->x + DEBRIS_SIZE / 2 - 8, d->y + DEBRIS_SIZE / 2 - 8,
+                                 SPRITE_BULLET, SPRITE_PALETTE(PALETTE_ENEMY_FAST));
+            }
+        }
+
+        d->x += d->vx;
+        d->y += d->vy;
+        if ((d->life & 0x03) == 0) d->vy++;
+        if (--d->life == 0) {
+            sprite_free(d->slot, 1);
+        }
+    }
+}
+
+// Draw and advance all effects
+// Scaled sprites grow from their top-left corner, so the position is
+// moved back by half the scaled size (8 << scale) to keep them centred.
+void effects_render(void) {
+    uint8_t i;
+    uint8_t step, sx, sy, pattern, flags, duration;
+    Effect *e;
+
+    for (i = 0; i < EFFECT_MAX; i++) {
+        e = &effects[i];
+        if (e->type == EFFECT_NONE) continue;
+
+        step = e->frame >> 2;
+
+        switch (e->type) {
+            case EFFECT_EXPLOSION:
+                sx = sy = explosion_scale[step];
+                pattern = SPRITE_ENEMY_BASE + (e->frame >> 1) % ENEMY_ANIM_FRAMES;
+                flags = SPRITE_PALETTE(PALETTE_ENEMY_FAST) | spin_flags[(e->frame + e->spin) & 0x03];
+                duration = EXPLOSION_FRAMES;
+                break;
+
+            case EFFECT_SHOCKWAVE:
+                sx = sy = shockwave_scale[step];
+                pattern = SPRITE_ENEMY_BASE;
+                flags = (e->frame & 0x02) ? SPRITE_PALETTE(PALETTE_ENEMY_FAST) : 0;
+                duration = SHOCKWAVE_FRAMES;
+                break;
+
+            default:  // EFFECT_WARP
+                sx = 0;
+                sy = warp_scale[step];
+                pattern = SPRITE_PLAYER;
+                flags = 0;
+                duration = WARP_FRAMES;
+                break;
+        }
+
+        sprite_set_scaled(e->slot, e->x - (8 << sx), e->y - (8 << sy),
+                          pattern, flags, SPRITE_SCALE(sx, sy));
+
+        if (++e->frame >= duration) {
+            sprite_free(e->slot, 1);
+            e->type = EFFECT_NONE;
+        }
+    }
+
+    effects_render_debris();
+}
@@ -0,0 +1,37 @@
+#ifndef EFFECTS_H
+#define EFFECTS_H
+
+#include <stdint.h>
+
+// Sprite effects built from existing patterns with hardware scaling,
+// mirroring and rotation, so they need no extra pattern memory.
+// Each effect uses one slot from the effects sprite band. Debris from
+// kills is drawn into Layer 2 through the overlay instead. The overlay
+// only handles the single-buffered 256x192 layout, so on wrap mode
+// levels and while a backdrop is being built debris falls back to one
+// effects band sprite per piece (bullet pattern, hot palette) and pieces
+// beyond the free slots are not shown.
+
+#define EFFECT_MAX  8   // Effects alive at once
+
+// Effect types
+#define EFFECT_NONE       0
+#define EFFECT_EXPLOSION  1   // Enemy frame in hot colours, grows 1x-4x, spinning
+#define EFFECT_SHOCKWAVE  2   // Ring pattern growing to 8x
+#define EFFECT_WARP       3   // Player stretched vertically, collapsing to 1x
+
+// Remove all effects and release their sprite slots
+void effects_init(void);
+
+// Start an effect centred on x, y (skipped if all effects are in use)
+void effects_spawn(uint8_t type, int16_t x, int16_t y);
+
+// Throw debris out from x, y (Layer 2 overlay, or sprites while
+// layer2_is_direct() is 0)
+void effects_debris(int16_t x, int16_t y);
+
+// Draw and advance all effects (call once per frame from game_render,
+// after overlay_restore)
+void effects_render(void);
+
+#endif // EFFECTS_H
@@ -1,199 +1,367 @@
+#include <arch/zxn.h>
+#include <intrinsic.h>
 #include <stdint.h>
 #include "enemy.h"
+#include "enemy_paths.h"
+#include "behaviour_code.h"
+#include "player.h"
+#include "shot.h"
+#include "rng.h"
 #include "sprites.h"
 
-// Global enemies array
-Entity enemies[MAX_ENEMIES];
-
-// Random seed
-static uint16_t rand_seed = 0x1234;
+// Global enemy pool
+Enemies enemies;
 
 // Formation tracking
 static uint8_t formation_leader[MAX_ENEMIES];  // Index of formation leader (255 = is leader or solo)
-static uint8_t formation_type[MAX_ENEMIES];    // Formation type for each enemy
-static uint8_t formation_phase[MAX_ENEMIES];   // Phase in movement pattern (for Galaga dive)
-static int16_t formation_start_x[MAX_ENEMIES]; // Starting X for pattern calculations
-
-// Simple random number generator
-static uint8_t fast_rand(void) {
-    rand_seed = rand_seed * 1103515245 + 12345;
-    return (uint8_t)(rand_seed >> 8);
+static uint8_t enemy_mirror[MAX_ENEMIES];      // 1 = entered from the right (paths and scripts mirrored)
+
+// Behaviour scripts (behaviour_code.h, see behaviour.h)
+static uint8_t script_pc[MAX_ENEMIES];         // Next instruction (SCRIPT_END = finished)
+static uint8_t script_wait[MAX_ENEMIES];       // Frames left to WAIT
+static uint8_t script_count[MAX_ENEMIES];      // LOOP/NEXT counter
+static uint8_t script_clock[MAX_ENEMIES];      // ai_clock when the script last ran
+
+// Script time-slicing (see enemies_update)
+static uint8_t ai_clock;                       // Frames counted by enemies_update
+static uint8_t ai_cursor;                      // Next position in enemies.pool.live[]
+
+// Baked flight paths (enemy_paths.asm)
+// Enemies on a path are moved by one delta byte per frame; their script
+// continues when the path ends.
+#define MMU_SLOT3_REG  0x53
+#define PATH_NONE      0xFF
+
+static const uint16_t path_offset[ENEMY_PATH_COUNT] = ENEMY_PATH_OFFSETS;
+static const uint8_t path_frames[ENEMY_PATH_COUNT] = ENEMY_PATH_FRAMES;
+static const int8_t path_min_x[ENEMY_PATH_COUNT] = ENEMY_PATH_MIN_X;
+static const int8_t path_max_x[ENEMY_PATH_COUNT] = ENEMY_PATH_MAX_X;
+
+static uint8_t path_id[MAX_ENEMIES];        // Path followed (PATH_NONE = free flight)
+static uint16_t path_pos[MAX_ENEMIES];      // Offset of the next delta in the path page
+static uint8_t path_left[MAX_ENEMIES];      // Frames left on the path
+
+// External reference to banked path data (forces linker to include)
+extern uint8_t enemy_paths_page46;
+
+void enemy_paths_force_include(void) {
+    volatile uint8_t *ptr = &enemy_paths_page46;
+    (void)ptr;
 }
 
+// Sprite slots per enemy: shadow (anchor) + enemy (relative), allocated
+// while the enemy is live
+static uint8_t enemy_sprite[MAX_ENEMIES];
+
 // Initialize enemies (clear all)
 void enemies_init(void) {
-    uint8_t i;
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        enemies[i].active = 0;
-        formation_leader[i] = 255;
-        formation_type[i] = 0;
-        formation_phase[i] = 0;
+    uint8_t n;
+
+    // Release slots left from the previous game
+    for (n = 0; n < enemies.pool.count; n++) {
+        sprite_free(enemy_sprite[enemies.pool.live[n]], 2);
     }
+    pool_init(&enemies.pool, MAX_ENEMIES);
 }
 
-// Sine table for smooth movement (quarter wave, scaled to max 48)
-static const int8_t sine_table[16] = {
-    0, 9, 18, 27, 33, 39, 44, 47, 48, 47, 44, 39, 33, 27, 18, 9
-};
-
-// Get sine value for angle (0-63 maps to 0-360 degrees)
-static int8_t get_sine(uint8_t angle) {
-    uint8_t quadrant = (angle >> 4) & 3;
-    uint8_t idx = angle & 15;
-
-    switch (quadrant) {
-        case 0: return sine_table[idx];
-        case 1: return sine_table[15 - idx];
-        case 2: return -sine_table[idx];
-        default: return -sine_table[15 - idx];
+// Remove a live enemy and release its sprite slots
+// Followers of a dead leader fly on alone, so a later enemy that reuses
+// the id does not steer them.
+void enemy_kill(uint8_t id) {
+    uint8_t n;
+
+    for (n = 0; n < enemies.pool.count; n++) {
+        if (formation_leader[enemies.pool.live[n]] == id) {
+            formation_leader[enemies.pool.live[n]] = 255;
+        }
     }
+    formation_leader[id] = 255;
+
+    sprite_free(enemy_sprite[id], 2);
+    pool_release(&enemies.pool, id);
 }
 
-// Update enemy positions
-void enemies_update(void) {
-    uint8_t i;
-    uint8_t leader;
-    int8_t wave_offset;
-
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        if (enemies[i].active) {
-
-            switch (formation_type[i]) {
-                case FORMATION_SINGLE_PATROL:
-                case FORMATION_GROUP_PATROL:
-                    // Patrol movement: move down while oscillating left/right
-                    // Slow horizontal movement - only every 2nd frame
-                    if (enemies[i].frame & 1) {
-                        enemies[i].x += enemies[i].dx;
-                    }
-                    enemies[i].y += enemies[i].dy;
-
-                    // Bounce off edges
-                    if (enemies[i].x < GAME_LEFT || enemies[i].x > GAME_RIGHT - ENEMY_WIDTH) {
-                        enemies[i].dx = -enemies[i].dx;
-                        // Sync group patrol direction
-                        if (formation_type[i] == FORMATION_GROUP_PATROL && formation_leader[i] == 255) {
-                            uint8_t j;
-                            for (j = 0; j < MAX_ENEMIES; j++) {
-                                if (formation_leader[j] == i) {
-                                    enemies[j].dx = enemies[i].dx;
-                                }
-                            }
-                        }
-                    }
-                    break;
-
-                case FORMATION_ARROW:
-                    // Arrow formation: follow leader with offset
-                    leader = formation_leader[i];
-                    if (leader == 255) {
-                        // Leader: simple patrol (slow horizontal)
-                        if (enemies[i].frame & 1) {
-                            enemies[i].x += enemies[i].dx;
-                        }
-                        enemies[i].y += enemies[i].dy;
-                        if (enemies[i].x < GAME_LEFT + 30 || enemies[i].x > GAME_RIGHT - ENEMY_WIDTH - 30) {
-                            enemies[i].dx = -enemies[i].dx;
-                        }
-                    } else if (enemies[leader].active) {
-                        // Follower: track leader position with offset
-                        enemies[i].y += enemies[i].dy;
-                        // Smoothly move toward leader x + offset
-                        int16_t target_x = enemies[leader].x + (int8_t)(formation_start_x[i]);
-                        if (enemies[i].frame & 1) {
-                            if (enemies[i].x < target_x) enemies[i].x += 1;
-                            else if (enemies[i].x > target_x) enemies[i].x -= 1;
-                        }
-                    } else {
-                        // Leader dead, become independent
-                        formation_type[i] = FORMATION_SINGLE_PATROL;
-                        formation_leader[i] = 255;
-                    }
-                    break;
-
-                case FORMATION_GALAGA_DIVE:
-                    // Galaga dive: slow swooping curved pattern
-                    // Only update phase every 2nd frame for slower movement
-                    if (enemies[i].frame & 1) {
-                        formation_phase[i] += 1;
-                    }
-
-                    wave_offset = get_sine(formation_phase[i]);
-                    enemies[i].x = formation_start_x[i] + (enemies[i].dx > 0 ? wave_offset : -wave_offset);
-
-                    // Slow vertical descent - only move every 2nd frame
-                    if (enemies[i].frame & 1) {
-                        enemies[i].y += 1;
-                    }
-                    break;
-            }
+// Put an enemy on a baked path (velocity is zero while on the path)
+static void start_path(uint8_t i, uint8_t path) {
+    path_id[i] = path;
+    path_pos[i] = path_offset[path];
+    path_left[i] = path_frames[path];
+    enemies.vx[i] = 0;
+    enemies.vy[i] = 0;
+}
 
-            // Deactivate if off screen bottom
-            if (enemies[i].y > SCREEN_HEIGHT) {
-                enemies[i].active = 0;
-                formation_leader[i] = 255;
-                formation_type[i] = 0;
-                formation_phase[i] = 0;
+// Reverse vx at the game area edges
+// Group followers take the leader's new direction
+static void enemy_bounce(uint8_t i) {
+    uint8_t m, j;
+
+    if ((enemies.x[i] < GAME_LEFT && enemies.vx[i] < 0) ||
+        (enemies.x[i] > GAME_RIGHT - ENEMY_WIDTH && enemies.vx[i] > 0)) {
+        enemies.vx[i] = -enemies.vx[i];
+        for (m = 0; m < enemies.pool.count; m++) {
+            j = enemies.pool.live[m];
+            if (formation_leader[j] == i) {
+                enemies.vx[j] = enemies.vx[i];
             }
+        }
+    }
+}
 
-            // Animation frame
-            enemies[i].frame++;
+// Fire at the player from the enemy's centre (only once on screen)
+static void enemy_fire(uint8_t i) {
+    if (enemies.y[i] < 0) return;
+    shots_fire(enemies.x[i] + (ENEMY_WIDTH / 2), enemies.y[i] + (ENEMY_HEIGHT / 2));
+}
+
+// Run an enemy's behaviour script until it yields (WAIT, PATH, END) or
+// SCRIPT_BUDGET instructions have run; it resumes there next time
+// WAIT counts down by the frames since the last run, so time-sliced
+// scripts keep their timing (resuming up to a slice late).
+static void enemy_run_script(uint8_t i) {
+    const uint8_t *op;
+    uint8_t pc = script_pc[i];
+    uint8_t budget = SCRIPT_BUDGET;
+    uint8_t elapsed = ai_clock - script_clock[i];
+    int16_t v, dx;
+
+    script_clock[i] = ai_clock;
+    if (script_wait[i] >= elapsed) {
+        script_wait[i] -= elapsed;
+        return;
+    }
+    script_wait[i] = 0;
+    if (path_id[i] != PATH_NONE) return;
+
+    while (pc != SCRIPT_END && budget != 0) {
+        budget--;
+        op = &behaviour_code[pc];
+
+        switch (op[0]) {
+            case OP_MOVE:
+                v = (int16_t)(int8_t)op[1] << 4;
+                enemies.vx[i] = enemy_mirror[i] ? -v : v;
+                v = (int16_t)(int8_t)op[2] << 4;
+                if (v > 0) v += enemies.drift[i] - ENEMY_DRIFT;  // Level bonus
+                enemies.vy[i] = v;
+                pc += 3;
+                break;
+
+            case OP_WAIT:
+                script_wait[i] = op[1] ? op[1] - 1 : 0;
+                pc += 2;
+                budget = 0;
+                break;
+
+            case OP_PATH:
+                start_path(i, op[1]);
+                pc += 2;
+                budget = 0;
+                break;
+
+            case OP_JUMP:
+                pc = op[1];
+                break;
+
+            case OP_LOOP:
+                script_count[i] = op[1];
+                pc += 2;
+                break;
+
+            case OP_NEXT:
+                pc = (--script_count[i] != 0) ? op[1] : pc + 2;
+                break;
+
+            case OP_FIRE:
+                enemy_fire(i);
+                pc += 1;
+                break;
+
+            case OP_IFLEFT:
+                pc = ((player.x < enemies.x[i]) != enemy_mirror[i]) ? op[1] : pc + 2;
+                break;
+
+            case OP_IFNEAR:
+                dx = player.x - enemies.x[i];
+                pc = (dx < op[1] && dx > -(int16_t)op[1]) ? op[2] : pc + 3;
+                break;
+
+            case OP_BOUNCE:
+                enemy_bounce(i);
+                pc += 1;
+                break;
+
+            case OP_SEEK:
+                v = (int16_t)op[1] << 4;
+                dx = player.x - enemies.x[i];
+                enemies.vx[i] = (dx < 0) ? -v : (dx > 0) ? v : 0;
+                pc += 2;
+                break;
+
+            default:  // OP_END
+                pc = SCRIPT_END;
+                break;
         }
     }
+
+    script_pc[i] = pc;
 }
 
-// Count free enemy slots
-static uint8_t count_free_slots(void) {
-    uint8_t count = 0;
-    uint8_t i;
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        if (!enemies[i].active) count++;
+// Run behaviour scripts, then move every live enemy
+// Above ENEMY_AI_THRESHOLD live enemies only ENEMY_AI_PER_FRAME scripts
+// run each frame, taking consecutive entries of the live list in round
+// robin, so steering and aiming cost stays flat however large
+// MAX_ENEMIES is. Velocities and path deltas are still applied to every
+// enemy each frame. Kills reorder the live list, so an enemy can
+// occasionally wait one slice longer.
+void enemies_update(void) {
+    uint8_t n, run;
+
+    ai_clock++;
+
+    if (enemies.pool.count <= ENEMY_AI_THRESHOLD) {
+        for (n = enemies.pool.count; n-- > 0;) {
+            enemy_run_script(enemies.pool.live[n]);
+        }
     }
-    return count;
+    else {
+        // count > ENEMY_AI_THRESHOLD >= ENEMY_AI_PER_FRAME: no enemy runs twice
+        if (ai_cursor >= enemies.pool.count) ai_cursor = 0;
+        for (run = 0; run < ENEMY_AI_PER_FRAME; run++) {
+            enemy_run_script(enemies.pool.live[ai_cursor]);
+            if (++ai_cursor == enemies.pool.count) ai_cursor = 0;
+        }
+    }
+
+    enemies_move();
 }
 
-// Find next free slot starting from index
-static uint8_t find_free_slot(uint8_t start) {
-    uint8_t i;
-    for (i = start; i < MAX_ENEMIES; i++) {
-        if (!enemies[i].active) return i;
+// Step every enemy on a path by one baked delta
+// The path page is mapped to slot 3 (0x6000) for the whole pass, so each
+// enemy costs one byte read: high nibble dx, low nibble dy (signed).
+static void enemies_follow_paths(void) {
+    const uint8_t *paths = (const uint8_t *)0x6000;
+    uint8_t n, i, delta, old_slot3;
+    int8_t dx;
+
+    intrinsic_di();
+
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    old_slot3 = IO_NEXTREG_DAT;
+    IO_NEXTREG_DAT = ENEMY_PATHS_PAGE;
+
+    for (n = 0; n < enemies.pool.count; n++) {
+        i = enemies.pool.live[n];
+        if (path_id[i] == PATH_NONE) continue;
+
+        delta = paths[path_pos[i]++];
+        dx = (int8_t)delta >> 4;
+        enemies.x[i] += enemy_mirror[i] ? -dx : dx;
+        enemies.y[i] += (int8_t)(delta << 4) >> 4;
+
+        // Path done: the script continues next frame
+        if (--path_left[i] == 0) {
+            path_id[i] = PATH_NONE;
+        }
     }
-    return 255;  // No slot found
+
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    IO_NEXTREG_DAT = old_slot3;
+
+    intrinsic_ei();
 }
 
-// Initialize a single enemy
-static void init_enemy(uint8_t idx, int16_t x, int16_t y, int8_t dx, int8_t dy, uint8_t level) {
-    uint8_t type = fast_rand() % 4;
+// Move all live enemies: baked path deltas, then 8.8 velocities
+void enemies_move(void) {
+    uint8_t n, i;
 
-    enemies[idx].active = 1;
-    enemies[idx].x = x;
-    enemies[idx].y = y;
-    enemies[idx].dx = dx;
-    enemies[idx].dy = dy;
-    enemies[idx].frame = 0;
+    enemies_follow_paths();
+
+    for (n = enemies.pool.count; n-- > 0;) {
+        i = enemies.pool.live[n];
+        FIX_INTEGRATE(enemies.x[i], enemies.xf[i], enemies.vx[i]);
+        FIX_INTEGRATE(enemies.y[i], enemies.yf[i], enemies.vy[i]);
+
+        // Remove if off screen bottom
+        if (enemies.y[i] > SCREEN_HEIGHT) {
+            enemy_kill(i);
+        }
+    }
+}
+
+// Take an enemy id from the pool and start its behaviour script
+// direction: -1 / +1 entering from the right / left (mirrors the script)
+// Descent speeds grow by ENEMY_SPEED_LVL per level.
+// Returns 255 if the pool is full
+static uint8_t init_enemy(int16_t x, int16_t y, int8_t direction, uint8_t script, uint8_t level) {
+    uint8_t type = rng8(RNG_SPAWN) % 4;
+    uint8_t idx = pool_alloc(&enemies.pool);
+
+    if (idx == POOL_NONE) return 255;
+
+    enemies.x[idx] = x;
+    enemies.y[idx] = y;
+    enemies.xf[idx] = 0;
+    enemies.yf[idx] = 0;
+    enemies.vx[idx] = 0;
+    enemies.vy[idx] = 0;
+    enemies.drift[idx] = ENEMY_DRIFT + (int16_t)(level - 1) * ENEMY_SPEED_LVL;
 
     if (type < 3 || level < 2) {
-        enemies[idx].type = 0;
-        enemies[idx].health = 1;
+        enemies.type[idx] = 0;
+        enemies.health[idx] = 1;
     } else {
-        enemies[idx].type = 1;
-        enemies[idx].health = 2;
+        enemies.type[idx] = 1;
+        enemies.health[idx] = 2;
     }
+
+    formation_leader[idx] = 255;
+    enemy_mirror[idx] = (direction < 0);
+    script_pc[idx] = script;
+    script_wait[idx] = 0;
+    script_clock[idx] = ai_clock - 1;
+    path_id[idx] = PATH_NONE;
+    enemy_sprite[idx] = SPRITE_SLOT_NONE;
+
+    // Run the first instructions now so the enemy moves from its first frame
+    enemy_run_script(idx);
+    return idx;
+}
+
+// Random spawn x that keeps a path (width extra pixels wide) on screen
+// Mirrored paths extend to the left instead of the right.
+static int16_t path_start_x(uint8_t path, int8_t direction, int16_t width) {
+    int16_t lo, hi;
+    uint8_t range;
+
+    if (direction > 0) {
+        lo = GAME_LEFT - path_min_x[path];
+        hi = GAME_RIGHT - ENEMY_WIDTH - width - path_max_x[path];
+    } else {
+        lo = GAME_LEFT + path_max_x[path];
+        hi = GAME_RIGHT - ENEMY_WIDTH - width + path_min_x[path];
+    }
+    if (hi <= lo) return lo;
+    range = (hi - lo > 255) ? 255 : hi - lo;
+    return lo + rng8(RNG_SPAWN) % range;
 }
 
 // Spawn a formation of enemies
-void enemies_spawn(uint8_t level) {
-    uint8_t free_slots = count_free_slots();
-    uint8_t form_type;
+// The formation decides placement; each enemy's movement comes from its
+// behaviour script (art/behaviours.txt). max_size caps the enemies used,
+// falling back to smaller formations like a nearly full pool does.
+void enemies_spawn(uint8_t level, uint8_t form_type, uint8_t max_size) {
+    uint8_t free_slots = POOL_FREE(&enemies.pool);
     uint8_t form_size;
-    uint8_t i, slot, leader_slot;
+    uint8_t i, slot, leader_slot, path, script;
     int16_t start_x;
     int8_t direction;
 
+    if (free_slots > max_size) free_slots = max_size;
     if (free_slots == 0) return;
 
-    // Choose formation based on available slots
-    form_type = fast_rand() % NUM_FORMATION_TYPES;
+    if (form_type == FORMATION_RANDOM) {
+        form_type = rng8(RNG_SPAWN) % NUM_FORMATION_TYPES;
+    }
 
     // Ensure we have enough slots for the formation
     if (form_type == FORMATION_GROUP_PATROL && free_slots < 2) {
@@ -202,29 +370,23 @@ void enemies_spawn(uint8_t level) {
     if (form_type == FORMATION_ARROW && free_slots < 3) {
         form_type = (free_slots >= 2) ? FORMATION_GROUP_PATROL : FORMATION_SINGLE_PATROL;
     }
-    if (form_type == FORMATION_GALAGA_DIVE && free_slots < 2) {
+    if ((form_type == FORMATION_GALAGA_DIVE || form_type == FORMATION_LOOP) && free_slots < 2) {
         form_type = FORMATION_SINGLE_PATROL;
     }
 
     // Random start side (0 = from left, 1 = from right)
-    direction = (fast_rand() & 1) ? 1 : -1;
+    direction = (rng8(RNG_SPAWN) & 1) ? 1 : -1;
 
     switch (form_type) {
         case FORMATION_SINGLE_PATROL:
             // Single enemy patrolling
-            slot = find_free_slot(0);
-            if (slot == 255) return;
-
             start_x = (direction > 0) ? GAME_LEFT + 10 : GAME_RIGHT - ENEMY_WIDTH - 10;
-            init_enemy(slot, start_x, -ENEMY_HEIGHT, direction, ENEMY_SPEED, level);
-            formation_type[slot] = FORMATION_SINGLE_PATROL;
-            formation_leader[slot] = 255;
-            formation_start_x[slot] = start_x;
+            init_enemy(start_x, -ENEMY_HEIGHT, direction, BEHAVIOUR_PATROL, level);
             break;
 
         case FORMATION_GROUP_PATROL:
             // 2-4 enemies patrolling together
-            form_size = 2 + (fast_rand() % 3);  // 2, 3, or 4
+            form_size = 2 + (rng8(RNG_SPAWN) % 3);  // 2, 3, or 4
             if (form_size > free_slots) form_size = free_slots;
 
             start_x = (direction > 0) ?
@@ -233,112 +395,94 @@ void enemies_spawn(uint8_t level) {
 
             leader_slot = 255;
             for (i = 0; i < form_size; i++) {
-                slot = find_free_slot(0);
+                // First is leader, the others follow its bounces
+                slot = init_enemy(start_x + i * FORMATION_SPACING,
+                                  -ENEMY_HEIGHT - (i * 8),  // Stagger entry
+                                  direction, i ? BEHAVIOUR_WING : BEHAVIOUR_PATROL, level);
                 if (slot == 255) break;
 
-                init_enemy(slot,
-                          start_x + i * FORMATION_SPACING,
-                          -ENEMY_HEIGHT - (i * 8),  // Stagger entry
-                          direction, ENEMY_SPEED, level);
-                formation_type[slot] = FORMATION_GROUP_PATROL;
-
                 if (i == 0) {
                     leader_slot = slot;
-                    formation_leader[slot] = 255;  // First is leader
                 } else {
                     formation_leader[slot] = leader_slot;
                 }
-                formation_start_x[slot] = enemies[slot].x;
             }
             break;
 
         case FORMATION_ARROW:
-            // Arrow/V formation (1 leader + 2 wings)
-            form_size = 3;
-            if (form_size > free_slots) form_size = free_slots;
-
-            start_x = GAME_LEFT + 60 + (fast_rand() % 100);
-
-            // Spawn leader at front
-            leader_slot = find_free_slot(0);
-            if (leader_slot == 255) return;
-
-            init_enemy(leader_slot, start_x, -ENEMY_HEIGHT, direction, ENEMY_SPEED, level);
-            formation_type[leader_slot] = FORMATION_ARROW;
-            formation_leader[leader_slot] = 255;
-            formation_start_x[leader_slot] = start_x;
-
-            // Spawn wing enemies
-            for (i = 1; i < form_size; i++) {
-                slot = find_free_slot(0);
+            // Arrow/V formation (1 leader + 2 wings) weaving down
+            // All three follow the same path, so the V keeps its shape
+            start_x = path_start_x(PATH_WEAVE, direction, 2 * FORMATION_SPACING) + FORMATION_SPACING;
+
+            for (i = 0; i < 3; i++) {
+                int8_t x_offset = (i == 0) ? 0 : (i == 1) ? -FORMATION_SPACING : FORMATION_SPACING;
+                slot = init_enemy(start_x + x_offset,
+                                  -ENEMY_HEIGHT - (i ? FORMATION_SPACING : 0),  // Wings behind leader
+                                  direction, BEHAVIOUR_WEAVE, level);
                 if (slot == 255) break;
-
-                int8_t x_offset = (i == 1) ? -FORMATION_SPACING : FORMATION_SPACING;
-                init_enemy(slot,
-                          start_x + x_offset,
-                          -ENEMY_HEIGHT - FORMATION_SPACING,  // Behind leader
-                          direction, ENEMY_SPEED, level);
-                formation_type[slot] = FORMATION_ARROW;
-                formation_leader[slot] = leader_slot;
-                formation_start_x[slot] = x_offset;  // Store offset for tracking
             }
             break;
 
         case FORMATION_GALAGA_DIVE:
-            // Galaga-style diving enemies
-            form_size = 2 + (fast_rand() % 2);  // 2 or 3
+        case FORMATION_LOOP:
+            // Galaga-style dive or loop: a train of 2-3 enemies on one path
+            form_size = 2 + (rng8(RNG_SPAWN) % 2);  // 2 or 3
             if (form_size > free_slots) form_size = free_slots;
 
-            start_x = GAME_LEFT + 40 + (fast_rand() % 140);
+            if (form_type == FORMATION_LOOP) {
+                path = PATH_LOOP;
+                script = BEHAVIOUR_LOOP;
+            } else {
+                path = PATH_DIVE;
+                script = BEHAVIOUR_DIVE;
+            }
+            start_x = path_start_x(path, direction, 0);
 
             for (i = 0; i < form_size; i++) {
-                slot = find_free_slot(0);
+                slot = init_enemy(start_x, -ENEMY_HEIGHT - (i * 24),  // Stagger entry
+                                  direction, script, level);
                 if (slot == 255) break;
-
-                init_enemy(slot,
-                          start_x + (i * 24) - ((form_size - 1) * 12),
-                          -ENEMY_HEIGHT - (i * 16),
-                          direction, 0, level);  // dy=0, movement handled by pattern
-                formation_type[slot] = FORMATION_GALAGA_DIVE;
-                formation_leader[slot] = 255;
-                formation_phase[slot] = i * 16;  // Stagger phases
-                formation_start_x[slot] = enemies[slot].x;
             }
             break;
     }
 }
 
-// Render enemy shadows
-// Returns next available sprite slot
-uint8_t enemies_render_shadows(uint8_t sprite_slot, uint8_t frame_count) {
-    uint8_t i;
-    (void)frame_count;  // Unused for shadows
-
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        if (enemies[i].active) {
-            int16_t enemy_center = enemies[i].x + (ENEMY_WIDTH / 2);
-            uint8_t shadow_mult = (enemy_center >= LEVEL_LEFT && enemy_center <= LEVEL_RIGHT) ? 1 : 2;
-            sprite_set(sprite_slot++, enemies[i].x + SHADOW_OFFSET_X * shadow_mult,
-                       enemies[i].y + SHADOW_OFFSET_Y * shadow_mult, SPRITE_ENEMY_SHADOW);
+// Render enemies with their shadows
+// Each shadow is an anchor sprite with the enemy as a relative sprite on
+// top, so the pair moves with one position write. Live enemies get a
+// slot pair on first render; enemy_kill releases it.
+void enemies_render(uint8_t frame_count) {
+    uint8_t n, i;
+    uint8_t slot, frame, pattern;
+    int16_t enemy_center;
+    int8_t shadow_dx, shadow_dy;
+
+    for (n = 0; n < enemies.pool.count; n++) {
+        i = enemies.pool.live[n];
+
+        if (enemy_sprite[i] == SPRITE_SLOT_NONE) {
+            enemy_sprite[i] = sprite_alloc(SPRITE_BAND_AIR, 2);
+            if (enemy_sprite[i] == SPRITE_SLOT_NONE) continue;
+        }
+        slot = enemy_sprite[i];
+
+        // Shadow falls further outside the level (lower ground)
+        enemy_center = enemies.x[i] + (ENEMY_WIDTH / 2);
+        shadow_dx = SHADOW_OFFSET_X;
+        shadow_dy = SHADOW_OFFSET_Y;
+        if (enemy_center < LEVEL_LEFT || enemy_center > LEVEL_RIGHT) {
+            shadow_dx *= 2;
+            shadow_dy *= 2;
         }
-    }
 
-    return sprite_slot;
-}
+        // Animate through frames A0-G0, offset by enemy index for variety
+        frame = ((frame_count >> 3) + i) % ENEMY_ANIM_FRAMES;
+        pattern = SPRITE_ENEMY_BASE + frame;
 
-// Render enemies
-// Returns next available sprite slot
-uint8_t enemies_render(uint8_t sprite_slot, uint8_t frame_count) {
-    uint8_t i;
-
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        if (enemies[i].active) {
-            // Animate through frames A0-G0, offset by enemy index for variety
-            uint8_t frame = ((frame_count >> 3) + i) % ENEMY_ANIM_FRAMES;
-            uint8_t pattern = SPRITE_ENEMY_BASE + frame;
-            sprite_set(sprite_slot++, enemies[i].x, enemies[i].y, pattern);
-        }
+        sprite_set(slot, enemies.x[i] + shadow_dx,
+                   enemies.y[i] + shadow_dy, SPRITE_ENEMY_SHADOW);
+        // Fast enemies reuse the same frames in the hot palette
+        sprite_set_relative(slot + 1, -shadow_dx, -shadow_dy, pattern,
+                            enemies.type[i] ? SPRITE_PALETTE(PALETTE_ENEMY_FAST) : 0);
     }
-
-    return sprite_slot;
 }
@@ -3,35 +3,57 @@
 
 #include <stdint.h>
 #include "game.h"
+#include "pool.h"
 
 // Formation types
 #define FORMATION_SINGLE_PATROL   0  // Single enemy patrol left/right
 #define FORMATION_GROUP_PATROL    1  // 2-4 enemies patrol together
 #define FORMATION_ARROW           2  // Arrow/V formation
 #define FORMATION_GALAGA_DIVE     3  // Galaga-style diving pattern
-#define NUM_FORMATION_TYPES       4
+#define FORMATION_LOOP            4  // Dive with a loop the loop
+#define NUM_FORMATION_TYPES       5
+#define FORMATION_RANDOM          0xFF  // enemies_spawn: pick one at random
 
 // Formation constants
 #define FORMATION_SPACING         20 // Spacing between enemies in formation
 
+// Enemy storage: one array per field, indexed by enemy id
+// Live ids are listed in pool.live[0..pool.count-1]
+typedef struct {
+    Pool pool;
+    int16_t x[MAX_ENEMIES];
+    int16_t y[MAX_ENEMIES];
+    uint8_t xf[MAX_ENEMIES];      // 8.8 fractions of x, y
+    uint8_t yf[MAX_ENEMIES];
+    int16_t vx[MAX_ENEMIES];      // 8.8 velocity
+    int16_t vy[MAX_ENEMIES];
+    int16_t drift[MAX_ENEMIES];   // 8.8 sideways speed for patrol/steering
+    uint8_t type[MAX_ENEMIES];
+    uint8_t health[MAX_ENEMIES];
+} Enemies;
+
 // Initialize enemies (clear all)
 void enemies_init(void);
 
-// Update enemy positions
+// Update enemy velocities from their formation, then move them
 void enemies_update(void);
 
-// Spawn a new enemy
-void enemies_spawn(uint8_t level);
+// Move all live enemies along their baked paths and by their 8.8
+// velocities (removes those that leave the bottom of the screen)
+void enemies_move(void);
+
+// Spawn a formation (FORMATION_* or FORMATION_RANDOM) of at most
+// max_size enemies
+void enemies_spawn(uint8_t level, uint8_t form_type, uint8_t max_size);
 
-// Render enemy shadows
-// Returns next available sprite slot
-uint8_t enemies_render_shadows(uint8_t sprite_slot, uint8_t frame_count);
+// Remove a live enemy and release its sprite slots
+void enemy_kill(uint8_t id);
 
-// Render enemies
-// Returns next available sprite slot
-uint8_t enemies_render(uint8_t sprite_slot, uint8_t frame_count);
+// Render enemies, each with its shadow (anchor + relative sprite pair
+// in slots allocated per enemy)
+void enemies_render(uint8_t frame_count);
 
-// Global enemies array
-extern Entity enemies[MAX_ENEMIES];
+// Global enemy pool
+extern Enemies enemies;
 
 #endif // ENEMY_H
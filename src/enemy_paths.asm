@@ -0,0 +1,53 @@
+; Generated from paths.txt: 3 paths, 700 bytes
+; Page: 46
+
+SECTION PAGE_46
+PUBLIC _enemy_paths_page46
+_enemy_paths_page46:
+    ; dive (240 frames)
+    defb 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x11, 0x01, 0x01, 0x02, 0x01, 0x11, 0x01, 0x01, 0x01, 0x11
+    defb 0x01, 0x11, 0x01, 0x12, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x11, 0x01, 0x10, 0x11
+    defb 0x01, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x10
+    defb 0x11, 0x11, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x00, 0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x11
+    defb 0x10, 0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x11, 0x10, 0x11, 0x10
+    defb 0x11, 0x11, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11
+    defb 0x01, 0x11, 0x10, 0x11, 0x01, 0x11, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x02, 0x01, 0x11
+    defb 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0xf1, 0x01, 0x02, 0xf1, 0x01, 0xf1, 0x01
+    defb 0xf1, 0x01, 0xf1, 0xf1, 0x01, 0xf1, 0xf0, 0xf1, 0x01, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0x01, 0xf1
+    defb 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0x01, 0xf1, 0xf0
+    defb 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1
+    defb 0xf1, 0xf0, 0x01, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0x01, 0xf0, 0xf1, 0xf1, 0xf1
+    defb 0xf1, 0x00, 0xf1, 0xf1, 0xf1, 0x01, 0xf1, 0xf1, 0xf1, 0x01, 0xf1, 0xf1, 0x01, 0xf0, 0x01, 0xf1
+    defb 0xf1, 0x01, 0xf2, 0x01, 0xf1, 0x01, 0xf1, 0x01, 0xf1, 0x01, 0x01, 0xf1, 0x01, 0x01, 0xf2, 0x01
+    defb 0x01, 0x01, 0xf1, 0x01, 0x01, 0x01, 0x02, 0xf1, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01
+    ; weave (240 frames)
+    defb 0x11, 0x20, 0x11, 0x10, 0x11, 0x11, 0x20, 0x11, 0x11, 0x10, 0x11, 0x11, 0x21, 0x11, 0x10, 0x11
+    defb 0x11, 0x11, 0x11, 0x01, 0x12, 0x11, 0x11, 0x01, 0x12, 0x01, 0x01, 0x02, 0x01, 0x01, 0xf2, 0x01
+    defb 0xf1, 0x02, 0xf1, 0x01, 0xf1, 0xf1, 0xf2, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1
+    defb 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1
+    defb 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1
+    defb 0x01, 0xf2, 0xf1, 0xf1, 0x01, 0xf1, 0x02, 0xf1, 0x01, 0xf2, 0x01, 0x01, 0x02, 0x01, 0x01, 0x12
+    defb 0x01, 0x11, 0x11, 0x12, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x21, 0x11, 0x11, 0x10, 0x11
+    defb 0x11, 0x20, 0x11, 0x11, 0x10, 0x11, 0x20, 0x11, 0x11, 0x20, 0x11, 0x10, 0x11, 0x11, 0x20, 0x11
+    defb 0x11, 0x10, 0x11, 0x11, 0x21, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x01, 0x12, 0x11, 0x11, 0x01
+    defb 0x12, 0x01, 0x01, 0x02, 0x01, 0x01, 0xf2, 0x01, 0xf1, 0x02, 0xf1, 0x01, 0xf1, 0xf1, 0xf2, 0x01
+    defb 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1
+    defb 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1
+    defb 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x01, 0xf2, 0xf1, 0xf1, 0x01, 0xf1, 0x02, 0xf1
+    defb 0x01, 0xf2, 0x01, 0x01, 0x02, 0x01, 0x01, 0x12, 0x01, 0x11, 0x11, 0x12, 0x01, 0x11, 0x11, 0x11
+    defb 0x11, 0x10, 0x11, 0x21, 0x11, 0x11, 0x10, 0x11, 0x11, 0x20, 0x11, 0x11, 0x10, 0x11, 0x20, 0x11
+    ; loop (220 frames)
+    defb 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02
+    defb 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01
+    defb 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02
+    defb 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x12, 0x02, 0x01, 0x12, 0x02, 0x11, 0x12, 0x02, 0x11, 0x12
+    defb 0x11, 0x12, 0x11, 0x22, 0x11, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x20, 0x11, 0x20, 0x20, 0x21
+    defb 0x10, 0x20, 0x20, 0x20, 0x1f, 0x20, 0x2f, 0x20, 0x1f, 0x2f, 0x1f, 0x2f, 0x1f, 0x1f, 0x2e, 0x1f
+    defb 0x1e, 0x1f, 0x0e, 0x1f, 0x1e, 0x0e, 0x0e, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0e, 0xfe, 0x0e
+    defb 0xff, 0x0e, 0xfe, 0xff, 0x0e, 0xfe, 0xef, 0xff, 0xfe, 0xff, 0xef, 0xff, 0xe0, 0xef, 0xe0, 0xff
+    defb 0xe0, 0xe0, 0xe0, 0xf1, 0xe0, 0xe1, 0xe0, 0xf1, 0xe1, 0xf1, 0xf1, 0xe2, 0xf1, 0xf1, 0xf2, 0xf1
+    defb 0xf2, 0xf2, 0x01, 0xf2, 0xf2, 0x01, 0xf2, 0x02, 0x02, 0x01, 0xf2, 0x02, 0x02, 0x02, 0x01, 0x02
+    defb 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02
+    defb 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02
+    defb 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01
+    defb 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02
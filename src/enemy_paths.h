@@ -0,0 +1,23 @@
+#ifndef ENEMY_PATHS_H
+#define ENEMY_PATHS_H
+
+// Enemy flight paths (generated by tools/bake_paths.py from art/paths.txt)
+// Delta streams live in page ENEMY_PATHS_PAGE (enemy_paths.asm), one byte
+// per frame: high nibble dx, low nibble dy, signed pixels.
+// Paths are drawn for enemies entering on the left; negate dx to mirror.
+
+#define ENEMY_PATHS_PAGE 46
+#define ENEMY_PATH_COUNT 3
+
+// Path IDs
+#define PATH_DIVE 0
+#define PATH_WEAVE 1
+#define PATH_LOOP 2
+
+// Per path: byte offset in the page, length in frames, x extent
+#define ENEMY_PATH_OFFSETS { 0, 240, 480 }
+#define ENEMY_PATH_FRAMES  { 240, 240, 220 }
+#define ENEMY_PATH_MIN_X   { 0, -26, 0 }
+#define ENEMY_PATH_MAX_X   { 80, 26, 60 }
+
+#endif
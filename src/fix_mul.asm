@@ -0,0 +1,16 @@
+; Unsigned 8x8 -> 16 multiply using the Z80N MUL D,E instruction
+;
+; uint16_t fix_mul8x8(uint16_t ab) __z88dk_fastcall
+;
+; H = a, L = b, result in HL (8 T-states for the multiply itself,
+; instead of a shift-and-add loop). Uses DE.
+
+SECTION code_user
+
+PUBLIC _fix_mul8x8
+
+_fix_mul8x8:
+    ex de,hl
+    mul d,e
+    ex de,hl
+    ret
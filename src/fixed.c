@@ -0,0 +1,74 @@
+#include <stdint.h>
+#include "fixed.h"
+
+// sin of 256 angles (1/256 turns), scaled to +-127
+// cos(a) is sin(a + 64), see FIX_COS
+const int8_t fix_sin_table[256] = {
+       0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+      49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+      90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+     117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+     127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+     117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+      90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+      49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+       0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+     -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+     -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+    -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+    -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+    -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+     -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+     -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3
+};
+
+// atan(i / 32) for i = 0..32 in 1/256 turns (one octant, 0..32)
+static const uint8_t atan_table[33] = {
+     0,  1,  3,  4,  5,  6,  8,  9, 10, 11, 12,
+    13, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 25, 26, 27, 28, 29, 29, 30, 31, 31, 32
+};
+
+// Direction of dx, dy in 1/256 turns (0 = right, 64 = down)
+// The octant comes from the signs and the larger axis, the angle inside
+// it from the ratio of the smaller to the larger axis (rounded to 1/32).
+// One division per call.
+uint8_t fix_atan2(int16_t dx, int16_t dy) {
+    uint16_t ax = (dx < 0) ? -dx : dx;
+    uint16_t ay = (dy < 0) ? -dy : dy;
+    uint8_t angle;
+
+    if (ax == 0 && ay == 0) return 64;
+
+    if (ax >= ay) {
+        angle = atan_table[((ay << 5) + (ax >> 1)) / ax];
+    } else {
+        angle = 64 - atan_table[((ax << 5) + (ay >> 1)) / ay];
+    }
+    if (dx < 0) angle = 128 - angle;
+    if (dy < 0) angle = -angle;
+    return angle;
+}
+
+// Signed 8-bit value times unsigned 8-bit scale (MUL DE on the magnitude)
+int16_t fix_mul(int8_t v, uint8_t scale) {
+    if (v < 0) {
+        return -(int16_t)FIX_MUL8X8((uint8_t)-v, scale);
+    }
+    return (int16_t)FIX_MUL8X8(v, scale);
+}
+
+// Approximate length of dx, dy: max + 3/8 min (within about 8%)
+uint16_t fix_distance(int16_t dx, int16_t dy) {
+    uint16_t ax = (dx < 0) ? -dx : dx;
+    uint16_t ay = (dy < 0) ? -dy : dy;
+    uint16_t lo;
+
+    if (ax < ay) {
+        lo = ax;
+        ax = ay;
+    } else {
+        lo = ay;
+    }
+    return ax + ((lo * 3) >> 3);
+}
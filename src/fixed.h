@@ -0,0 +1,51 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+
+// Fixed-point math: 8.8 positions and velocities, byte angles with
+// sin/cos tables, atan2, 8x8 multiply and approximate distance
+
+// 8.8 fixed point: high byte whole pixels, low byte 1/256 pixel
+// Velocities are int16_t 8.8 (-128.0 .. +127.996 pixels per frame).
+// Positions stay whole pixels (int16_t, for collision and sprites) with
+// a separate uint8_t fraction byte, so the screen range is not limited
+// to 8.8.
+
+#define FIX_ONE         256
+#define FIX(n)          ((int16_t)((n) * FIX_ONE))   // Constant to 8.8
+#define FIX_INT(f)      ((int16_t)(f) >> 8)          // Whole part (rounds down)
+
+// Add an 8.8 velocity to a position held as pixels + fraction byte
+// The fraction add carries into the pixel part; vel >> 8 is the signed
+// whole part, so negative velocities work the same way.
+#define FIX_INTEGRATE(pos, frac, vel) do {                  \
+        uint16_t fix_f_ = (uint16_t)(frac) + (uint8_t)(vel); \
+        (frac) = (uint8_t)fix_f_;                            \
+        (pos) += FIX_INT(vel) + (int16_t)(fix_f_ >> 8);      \
+    } while (0)
+
+// Angles are one byte, 1/256 turns: 0 = right, 64 = down (screen y),
+// so they wrap for free. sin/cos are +-127 (1.0 = 127).
+extern const int8_t fix_sin_table[256];
+
+#define FIX_SIN(a)      (fix_sin_table[(uint8_t)(a)])
+#define FIX_COS(a)      (fix_sin_table[(uint8_t)((a) + 64)])
+
+// Unsigned 8x8 -> 16 multiply with the Z80N MUL D,E instruction
+// (fix_mul.asm, fastcall: a in H, b in L)
+uint16_t fix_mul8x8(uint16_t ab) __z88dk_fastcall;
+
+#define FIX_MUL8X8(a, b)  fix_mul8x8(((uint16_t)(uint8_t)(a) << 8) | (uint8_t)(b))
+
+// Signed 8-bit value times unsigned 8-bit scale
+// e.g. fix_mul(FIX_COS(a), speed >> 7) gives an 8.8 velocity component
+int16_t fix_mul(int8_t v, uint8_t scale);
+
+// Direction of dx, dy as an angle (table lookup, one division)
+uint8_t fix_atan2(int16_t dx, int16_t dy);
+
+// Approximate length of dx, dy (no square root, within 8%)
+uint16_t fix_distance(int16_t dx, int16_t dy);
+
+#endif // FIXED_H
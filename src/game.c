@@ -7,16 +7,22 @@
 #include "player.h"
 #include "bullet.h"
 #include "enemy.h"
+#include "shot.h"
 #include "collision.h"
 #include "sprites.h"
 #include "layer2.h"
+#include "overlay.h"
+#include "copper.h"
 #include "tilemap.h"
 #include "ula.h"
 #include "sound.h"
 #include "level.h"
 #include "level1.h"
+#include "rng.h"
+#include "director.h"
 #include "game_hud.h"
 #include "debug_hud.h"
+#include "effects.h"
 
 // Global game data
 GameData game;
@@ -24,6 +30,15 @@ GameData game;
 // Hole collision cooldown (prevents continuous point loss)
 static uint8_t hole_cooldown = 0;
 
+// Level backdrop (L2_BG_*) and whether the copper scrolls the star field
+static uint8_t backdrop = L2_BG_BORDER;
+static uint8_t star_copper = 0;
+
+// Star field bands: far, middle and near stars (8.8 pixels per frame)
+#define STAR_BANDS  3
+static const uint8_t star_band_lines[STAR_BANDS] = { 0, 64, 128 };
+static const int16_t star_band_speeds[STAR_BANDS] = { 0x0040, 0x0100, 0x0200 };
+
 // Read keyboard/joystick input
 uint8_t input_read(void) {
     uint8_t result = 0;
@@ -71,8 +86,41 @@ uint8_t input_read(void) {
     return result;
 }
 
+// Switch Layer 2 to the backdrop for a level
+// Level 1 shows the border art; later levels cycle through a block
+// scatter, then the tile pattern and the star field in wrap mode, where
+// scrolling needs no modulo. The background job builds the new backdrop
+// in the back buffer over 40-50 frames while the old one stays on
+// screen, then flips it in (main.c steps it). The star field's Y scroll
+// moves to the copper once it is shown (game_update).
+static void game_set_backdrop(uint8_t level) {
+    static const uint8_t cycle[3] = { L2_BG_TILES, L2_BG_STARS, L2_BG_BLOCKS };
+    uint8_t next;
+
+    next = (level == 1) ? L2_BG_BORDER : cycle[level % 3];
+
+    if (next == backdrop) return;
+
+    // Put back the old backdrop under effects (this also empties the
+    // overlay): it stays on screen while the job builds the new one
+    overlay_restore();
+
+    // The old star field scrolls as one piece until it is replaced
+    if (star_copper) {
+        copper_stop();
+        star_copper = 0;
+    }
+
+    layer2_bg_job_start(next);
+    backdrop = next;
+}
+
 // Initialize game state
 void game_init(void) {
+    // Put back background under any effects left from the last game
+    overlay_restore();
+    game_set_backdrop(1);
+
     // Reset scroll positions FIRST (before tilemap_refresh uses them)
     scroll_y = 0;
     layer2_scroll(0);
@@ -91,13 +139,20 @@ void game_init(void) {
     // Clear bullets
     bullets_init();
 
-    // Clear enemies
+    // Clear enemies and their shots
     enemies_init();
+    shots_init();
+
+    // Clear effects and warp the player in
+    effects_init();
+    effects_spawn(EFFECT_WARP, player.x + PLAYER_WIDTH / 2, player.y + PLAYER_HEIGHT / 2);
 
     // Initialize game data
     game.state = STATE_PLAYING;
     game.score = 0;
     game.level = 1;
+    rng_seed_level(game.level);
+    director_init();
     game.wave = 0;
     game.enemies_killed = 0;
     game.frame_count = 0;
@@ -141,6 +196,7 @@ void game_update(void) {
             return;
         }
         player_reset_position();
+        effects_spawn(EFFECT_WARP, player.x + PLAYER_WIDTH / 2, player.y + PLAYER_HEIGHT / 2);
         game.shake_timer = SHAKE_DURATION;
         game.crash_timer = CRASH_TEXT_DURATION;
         game.crash_type = crash;
@@ -174,7 +230,16 @@ void game_update(void) {
     tilemap_scroll(scroll_y);
 
     // Layer 2 (background) scrolls at half speed for parallax
-    layer2_scroll(scroll_y / 2);
+    // Once the star field is on screen its bands are scrolled by the copper
+    if (layer2_get_wrap_mode() == L2_WRAP_STARS && backdrop == L2_BG_STARS) {
+        if (!star_copper) {
+            copper_parallax_init(star_band_lines, star_band_speeds, STAR_BANDS);
+            star_copper = 1;
+        }
+    }
+    else {
+        layer2_scroll(scroll_y / 2);
+    }
 
     // Horizontal parallax: grid scrolls opposite to player movement
     {
@@ -185,6 +250,7 @@ void game_update(void) {
     // Update game objects
     bullets_update();
     enemies_update();
+    shots_update();
 
     // Check collisions
     coll_result = collision_bullets_enemies();
@@ -195,6 +261,9 @@ void game_update(void) {
     }
 
     crash = collision_player_enemies();
+    if (crash == CRASH_NONE) {
+        crash = collision_player_shots();
+    }
     if (crash != CRASH_NONE) {
         game.crash_type = crash;
         game.shake_timer = SHAKE_DURATION;
@@ -213,16 +282,16 @@ void game_update(void) {
         return;
     }
 
-    // Spawn enemies periodically
+    // Spawn scripted and timed waves
     game.frame_count++;
-    if (game.frame_count % 60 == 0) {
-        enemies_spawn(game.level);
-    }
+    director_update();
 
     // Level progression
     if (game.enemies_killed >= 10 * game.level) {
         game.level++;
         game.enemies_killed = 0;
+        rng_seed_level(game.level);
+        game_set_backdrop(game.level);
     }
 
     // Survival bonus (every 10 frames)
@@ -249,60 +318,46 @@ int8_t game_get_shake_offset(void) {
 
 // Update during dying state - just move enemies, no scrolling
 void game_update_dying(void) {
-    uint8_t i;
-
     // Decrement timers
     if (game.crash_timer > 0) game.crash_timer--;
     if (game.shake_timer > 0) game.shake_timer--;
 
     // Move enemies (let them continue moving down)
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        if (enemies[i].active) {
-            enemies[i].y += enemies[i].dy;
-            // Deactivate if off screen
-            if (enemies[i].y > SCREEN_HEIGHT + 16) {
-                enemies[i].active = 0;
-            }
-        }
-    }
+    enemies_move();
 
     // Update frame counter for animation
     game.frame_count++;
 
-    // Spawn fewer enemies (every 120 frames instead of 60)
-    if (game.frame_count % 120 == 0) {
-        enemies_spawn(game.level);
-    }
+    // Keep timed waves coming (at half the rate)
+    director_update();
 }
 
 // Render during dying state - no player, just enemies
 void game_render_dying(void) {
-    uint8_t sprite_slot = 0;
+    // Restore Layer 2 under last frame's effects
+    overlay_restore();
 
     // Render HUD text overlay
     game_hud_render();
     debug_hud_render();
 
     // Hide player slots (player + shadow)
-    sprite_slot = player_hide(sprite_slot);
-
-    // Hide bullet slots
-    sprite_slot = bullets_hide(sprite_slot);
+    player_hide();
 
-    // Render enemy shadows
-    sprite_slot = enemies_render_shadows(sprite_slot, game.frame_count);
+    // Hide bullets and enemy shots and release their slots
+    bullets_hide();
+    shots_hide();
 
-    // Render enemies with animation
-    sprite_slot = enemies_render(sprite_slot, game.frame_count);
+    // Render enemies with animation (each shadow is drawn behind its enemy)
+    enemies_render(game.frame_count);
 
-    // Hide unused slots
-    while (sprite_slot < 32) {
-        sprite_hide(sprite_slot++);
-    }
+    // Let explosions play out
+    effects_render();
 }
 
 void game_render(void) {
-    uint8_t sprite_slot = 0;
+    // Restore Layer 2 under last frame's effects
+    overlay_restore();
 
     // Render HUD text overlay
     game_hud_render();
@@ -310,20 +365,21 @@ void game_render(void) {
 
     // Level is rendered by tilemap hardware (scrolled via tilemap_scroll)
 
+    // Each entity draws into its own allocated sprite slots and releases
+    // them when it goes away, so unchanged slots are not rewritten
+
     // Render player shadow and player
-    sprite_slot = player_render(sprite_slot);
+    player_render();
 
     // Render bullets
-    sprite_slot = bullets_render(sprite_slot);
+    bullets_render();
 
-    // Render enemy shadows first (behind enemies)
-    sprite_slot = enemies_render_shadows(sprite_slot, game.frame_count);
+    // Render enemy shots
+    shots_render();
 
-    // Render enemies with animation
-    sprite_slot = enemies_render(sprite_slot, game.frame_count);
+    // Render enemies with animation (each shadow is drawn behind its enemy)
+    enemies_render(game.frame_count);
 
-    // Hide unused sprite slots
-    while (sprite_slot < 32) {
-        sprite_hide(sprite_slot++);
-    }
+    // Render explosions and other scaled sprite effects
+    effects_render();
 }
@@ -2,6 +2,8 @@
 #define GAME_H
 
 #include <stdint.h>
+#include "spriteset.h"
+#include "fixed.h"
 
 // Screen dimensions (Layer 2 256x192)
 #define SCREEN_WIDTH    256
@@ -21,22 +23,32 @@
 // Player constants (vertical scroller - player at bottom)
 #define PLAYER_WIDTH    16
 #define PLAYER_HEIGHT   16
-#define PLAYER_SPEED    3
+#define PLAYER_SPEED    FIX(3)  // 8.8 pixels per frame
 #define PLAYER_START_X  120  // Center of screen
 #define PLAYER_START_Y  160  // Near bottom
 #define PLAYER_MAX_LIVES 3
 
 // Bullet constants
-#define MAX_BULLETS     8
-#define BULLET_SPEED    4
+#define MAX_BULLETS     8    // Pool capacity (up to POOL_MAX)
+#define BULLET_SPEED    FIX(4)  // 8.8 pixels per frame
 #define BULLET_WIDTH    8
 #define BULLET_HEIGHT   4
 
+// Enemy shot constants (x, y is the shot centre)
+#define MAX_SHOTS       16   // Pool capacity (up to POOL_MAX)
+#define SHOT_SPEED      FIX(2)  // 8.8 pixels per frame (multiple of 128)
+#define SHOT_SIZE       4    // Hitbox width and height
+#define SHOTS_PER_FRAME 2    // Most shots fired in one frame
+
 // Enemy constants
-#define MAX_ENEMIES     8
+#define MAX_ENEMIES     8    // Pool capacity (up to POOL_MAX)
 #define ENEMY_WIDTH     16
 #define ENEMY_HEIGHT    16
-#define ENEMY_SPEED     1
+#define ENEMY_SPEED     FIX(1)       // 8.8 descent, pixels per frame
+#define ENEMY_DRIFT     FIX(0.5)     // 8.8 sideways patrol speed
+#define ENEMY_SPEED_LVL FIX(0.0625)  // Added to enemy speeds per level
+#define ENEMY_AI_THRESHOLD 6   // More live enemies than this: scripts time-sliced
+#define ENEMY_AI_PER_FRAME 4   // Scripts run per frame while time-sliced (<= threshold)
 
 // Scoring constants
 #define SCORE_PER_SECOND    10   // Points for surviving each second
@@ -47,13 +59,17 @@
 #define SHAKE_DURATION      20   // Frames of screen shake
 #define CRASH_TEXT_DURATION 60   // Frames to show "CRASH"
 
-// Sprite pattern slots
-#define SPRITE_PLAYER       0
-#define SPRITE_BULLET       1
-#define SPRITE_ENEMY_BASE   2   // Enemy frames A0-G0 at slots 2-8
+// Sprite pattern IDs (spriteset.h), mapped to hardware slots by the
+// pattern cache in sprites.c
+#define SPRITE_PLAYER       SPRITE_ID_H0
+#define SPRITE_BULLET       SPRITE_ID_B1
+#define SPRITE_ENEMY_BASE   SPRITE_ID_A0  // Enemy frames A0-G0
 #define ENEMY_ANIM_FRAMES   7   // 7 animation frames
-#define SPRITE_SHADOW       9
-#define SPRITE_ENEMY_SHADOW 10
+#define SPRITE_SHADOW       SPRITE_ID_A1
+#define SPRITE_ENEMY_SHADOW SPRITE_ID_C1
+
+// Sprite palette offsets (16 colour banks for 4-bit patterns)
+#define PALETTE_ENEMY_FAST  1   // Hot colours for fast enemies
 
 // Shadow offset
 #define SHADOW_OFFSET_X  3
@@ -82,22 +98,14 @@ typedef enum {
     STATE_LEVELCOMPLETE
 } GameState;
 
-// Entity structure for game objects
-typedef struct {
-    int16_t x;
-    int16_t y;
-    int8_t dx;
-    int8_t dy;
-    uint8_t active;
-    uint8_t type;
-    uint8_t frame;
-    uint8_t health;
-} Entity;
-
 // Player structure
 typedef struct {
     int16_t x;
     int16_t y;
+    uint8_t xf;               // 8.8 fraction of x
+    uint8_t yf;               // 8.8 fraction of y
+    int16_t vx;               // 8.8 velocity from input
+    int16_t vy;
     uint8_t lives;
     uint8_t shield;
     uint8_t fire_cooldown;
@@ -110,6 +118,7 @@ typedef struct {
 #define CRASH_ENEMY      2  // Yellow flash (normal enemy)
 #define CRASH_ENEMY_FAST 3  // Red flash (fast enemy)
 #define CRASH_LEVEL      4  // White flash (fell off level)
+#define CRASH_SHOT       5  // Red flash (hit by an enemy shot)
 
 // Game data structure
 typedef struct {
@@ -2,17 +2,22 @@
 #include <z80.h>
 #include <intrinsic.h>
 #include <stdint.h>
+#include <string.h>
 #include "layer2.h"
+#include "lz_unpack.h"
 #include "tileset.h"
+#include "rng.h"
 
 // External references to banked data (forces linker to include)
-extern uint8_t border_page40;
-extern uint8_t border_page41;
+extern uint8_t border_blocks_page40;
+
+// Pre-composed background, LZ compressed in page 42 (png_to_asm.py --background --lz)
+extern uint8_t layer2_bg_lz_page42;
 
 // Use a dummy reference if necessary
 void force_include(void) {
-    volatile uint8_t *ptr = &border_page40;
-    ptr = &border_page41;
+    volatile uint8_t *ptr = &border_blocks_page40;
+    ptr = &layer2_bg_lz_page42;
     (void)ptr;
 }
 
@@ -21,10 +26,39 @@ void force_include(void) {
 #define MMU_SLOT2_REG  0x52
 #define MMU_SLOT3_REG  0x53
 
-// Border image stored in 8K pages 40-41 loaded by NEX loader
-// Image dimensions: 60x192 = 11520 bytes
-#define BORDER_IMAGE_WIDTH   60
-#define BORDER_IMAGE_HEIGHT  192
+// First 8K bank of Layer 2 and lines per bank (32 * 256 = 8192 bytes)
+#define L2_FIRST_BANK     16
+#define L2_BANK_COUNT     6
+
+// 320x256 wrap mode: 10 banks of 32 columns (80K)
+#define L2_WRAP_BANK_COUNT  10
+
+// Shadow (back) buffer for double buffering: 16K bank 13 = 8K banks 26-35
+// Leaves banks 22-25 free so the front buffer can grow to 320x256
+#define L2_SHADOW_BANK    26
+#define L2_BAND_LINES     32
+#define L2_HEIGHT         192
+
+// Address of line y within the bank mapped at slot 2
+#define L2_ROW_ADDR(y)    ((uint8_t *)0x4000 + ((uint16_t)((y) & (L2_BAND_LINES - 1)) << 8))
+
+// Border image stored as an 8x8 block dictionary in 8K page 40
+// (tools/png_to_asm.py --blocks). 60x192 image padded to 8x24 blocks.
+#define BORDER_BLOCKS_PAGE   40
+#define BORDER_BLOCKS_WIDTH  64
+
+// Composed 256x192 background (black fill + border, mirrored border)
+#define BACKGROUND_LZ_PAGE   42
+
+// LZ image directory (png_to_asm.py --lz): count, then page + offset per bank
+#define LZ_MAX_CHUNKS        8
+#define LZ_DIR_ENTRY_SIZE    3
+
+// Block image page layout: 4 byte header, map, then 64 byte blocks
+#define BLOCK_HDR_COLS       0
+#define BLOCK_HDR_ROWS       1
+#define BLOCK_HDR_SIZE       4
+#define BLOCK_MAP_MIRROR     0x80
 
 // Layer 2 background tiles (2x2 block = 16x16 pixels from tileset.h)
 #define L2_TILE_TL  tile_O0  // top-left
@@ -36,6 +70,50 @@ void force_include(void) {
 // Each block is 16x16 = 256 pixels, screen is 256x192 = 49152 pixels
 // 20% coverage = ~38 blocks
 #define L2_BLOCK_COVERAGE  20
+#define L2_BLOCK_SLOTS     192   // 16 x 12 block positions
+
+// Background job budget per layer2_bg_job_step() call (about 2K of writes)
+#define L2_JOB_ROWS_PER_STEP    8    // Cleared lines (2K memset)
+#define L2_JOB_BLOCKS_PER_STEP  2    // Scattered 16x16 blocks
+#define L2_JOB_COLS_PER_STEP    8    // 320x256 columns (2K)
+#define L2_JOB_COL_GROUPS       (32 / L2_JOB_COLS_PER_STEP)   // Steps per 8K bank
+#define L2_JOB_FILL_STEPS       (L2_WRAP_BANK_COUNT * L2_JOB_COL_GROUPS)
+
+// Background job phases
+#define L2_JOB_IDLE    0
+#define L2_JOB_CLEAR   1   // Black fill, 8 lines per step
+#define L2_JOB_BLOCKS  2   // Random block scatter
+#define L2_JOB_BORDER  3   // Border art, one 8 line block row per step
+#define L2_JOB_FILL    4   // 320x256 tile pattern or star field, by columns
+#define L2_STARS_PER_BANK  24
+#define L2_STARS_PER_STEP  (L2_STARS_PER_BANK / L2_JOB_COL_GROUPS)
+
+// Double buffering state
+// l2_draw_bank is the first 8K bank all drawing functions write to:
+// the displayed buffer when single buffered, the back buffer otherwise
+static uint8_t l2_draw_bank = L2_FIRST_BANK;
+static uint8_t l2_front_bank = L2_FIRST_BANK;
+static uint8_t l2_double_buffered = 0;
+static uint8_t l2_flip_pending = 0;
+static uint8_t l2_single_after_flip = 0;   // Disable requested while a flip was pending
+static uint8_t l2_flip_wrap = 0;           // Wrap mode to switch to with the pending flip
+
+// Last values written to the scroll registers (0x16 / 0x17)
+static uint8_t l2_scroll_x = 0;
+static uint8_t l2_scroll_y = 0;
+
+// Incremental background job state
+static uint8_t l2_job_phase = L2_JOB_IDLE;
+static uint8_t l2_job_backdrop = 0;   // L2_BG_* being built
+static uint8_t l2_job_wrap = 0;       // Its wrap mode, applied at the flip
+static uint8_t l2_job_pos = 0;        // Next line (256x192) or column group (320x256)
+static uint8_t l2_job_blocks = 0;
+
+// Banks per buffer: 6 for 256x192, 10 in 320x256 wrap mode
+// Both follow the displayed buffer; a backdrop built by the job switches
+// them at its flip
+static uint8_t l2_bank_count = L2_BANK_COUNT;
+static uint8_t l2_wrap_mode = 0;
 
 // ZX Spectrum colors in RGB332 for Layer 2
 static const uint8_t zx_to_rgb332[16] = {
@@ -57,81 +135,75 @@ static const uint8_t zx_to_rgb332[16] = {
     0xFF   // 15: Bright White
 };
 
-// Simple LCG random number generator
-static uint16_t rand_seed = 12345;
+// Expansion cache: one 4-bit tile byte (two pixels) -> two RGB332 pixels
+// Low byte is the left pixel (high nibble), so a uint16_t store writes
+// both pixels in screen order. Built by layer2_init.
+static uint16_t l2_nibble_rgb[256];
+
+// 16x16 background block (2x2 tiles) expanded to RGB332, built on first use
+static uint8_t l2_block_cache[256];
+static uint8_t l2_block_cached = 0;
+
+// Scratch buffer for decoded tiles/blocks (16x16 max)
+static uint8_t l2_block_buf[256];
+
+// Build the nibble pair expansion table
+static void layer2_build_nibble_cache(void) {
+    uint16_t b = 0;
 
-static uint16_t rand16(void) {
-    rand_seed = rand_seed * 25173 + 13849;
-    return rand_seed;
+    do {
+        l2_nibble_rgb[b] = zx_to_rgb332[b >> 4] |
+                           ((uint16_t)zx_to_rgb332[b & 0x0F] << 8);
+    } while (++b < 256);
 }
 
-// Get pixel from 4-bit tile data
-static uint8_t get_tile_pixel(const uint8_t *tile, uint8_t px, uint8_t py) {
-    uint8_t byte = tile[py * 4 + (px >> 1)];
-    if (px & 1) {
-        return byte & 0x0F;  // Low nibble (right pixel)
+// Expand an 8x8 4-bit tile into RGB332 rows stride bytes apart
+static void layer2_expand_tile(const uint8_t *tile, uint8_t *dst, uint8_t stride) {
+    uint8_t py;
+    uint16_t *row;
+
+    for (py = 0; py < 8; py++) {
+        row = (uint16_t *)dst;
+        row[0] = l2_nibble_rgb[tile[0]];
+        row[1] = l2_nibble_rgb[tile[1]];
+        row[2] = l2_nibble_rgb[tile[2]];
+        row[3] = l2_nibble_rgb[tile[3]];
+        tile += 4;
+        dst += stride;
     }
-    else {
-        return byte >> 4;    // High nibble (left pixel)
+}
+
+// Expanded 16x16 background block (rows 16 bytes apart)
+static const uint8_t *layer2_get_block(void) {
+    if (!l2_block_cached) {
+        layer2_expand_tile(L2_TILE_TL, l2_block_cache, 16);
+        layer2_expand_tile(L2_TILE_TR, l2_block_cache + 8, 16);
+        layer2_expand_tile(L2_TILE_BL, l2_block_cache + 128, 16);
+        layer2_expand_tile(L2_TILE_BR, l2_block_cache + 136, 16);
+        l2_block_cached = 1;
     }
+    return l2_block_cache;
 }
 
 // Draw a single 8x8 tile at position (x, y)
 static void layer2_draw_tile(uint8_t x, uint8_t y, const uint8_t *tile) {
-    uint8_t px, py;
-    uint8_t pal_idx;
-
-    for (py = 0; py < 8; py++) {
-        if (y + py >= 192) continue;
-        for (px = 0; px < 8; px++) {
-            pal_idx = get_tile_pixel(tile, px, py);
-            layer2_plot(x + px, y + py, zx_to_rgb332[pal_idx]);
-        }
-    }
+    // Expand tile to RGB332, then blit it in one pass
+    layer2_expand_tile(tile, l2_block_buf, 8);
+    layer2_blit(x, y, 8, 8, l2_block_buf);
 }
 
 // Draw a single 16x16 block at position (bx, by)
 static void layer2_draw_block(uint8_t bx, uint8_t by) {
-    uint8_t px, py;
-    uint8_t tile_px, tile_py;
-    const uint8_t *tile;
-    uint8_t pal_idx;
-    uint8_t screen_x, screen_y;
-
-    for (py = 0; py < 16; py++) {
-        screen_y = by + py;
-        if (screen_y >= 192) continue;
-
-        tile_py = py & 0x07;
-
-        for (px = 0; px < 16; px++) {
-            screen_x = bx + px;
-            // screen_x wraps naturally with uint8_t
-
-            tile_px = px & 0x07;
-
-            // Select tile from 2x2 block
-            if (py < 8) {
-                tile = (px < 8) ? L2_TILE_TL : L2_TILE_TR;
-            } else {
-                tile = (px < 8) ? L2_TILE_BL : L2_TILE_BR;
-            }
-
-            pal_idx = get_tile_pixel(tile, tile_px, tile_py);
-            layer2_plot(screen_x, screen_y, zx_to_rgb332[pal_idx]);
-        }
-    }
+    layer2_blit(bx, by, 16, 16, layer2_get_block());
 }
 
 // Draw 2x2 tile pattern to one 8K bank of Layer 2
+// Every row is 16 copies of one expanded block row
 static void layer2_draw_8k_bank(uint8_t l2_bank, uint8_t start_y) {
-    uint8_t y;
-    uint16_t x;
+    uint8_t y, rep;
     uint8_t *row;
-    uint8_t world_y, block_y, block_x;
-    uint8_t tile_px, tile_py;
-    const uint8_t *tile;
-    uint8_t pal_idx;
+    const uint8_t *block = layer2_get_block();
+    const uint8_t *block_row;
     uint8_t old_bank;
 
     // Save current MMU slot 2 bank
@@ -143,30 +215,14 @@ static void layer2_draw_8k_bank(uint8_t l2_bank, uint8_t start_y) {
     IO_NEXTREG_DAT = l2_bank;
 
     // Each 8K bank = 32 lines (256 bytes per line, 32 * 256 = 8192)
+    row = (uint8_t *)0x4000;
     for (y = 0; y < 32; y++) {
-        world_y = start_y + y;
-        row = (uint8_t *)(0x4000 + y * 256);
-
         // Which row in the 16x16 block (0-15)?
-        block_y = world_y & 0x0F;
-        tile_py = block_y & 0x07;  // Pixel row within 8x8 tile
-
-        for (x = 0; x < 256; x++) {
-            // Which column in the 16x16 block (0-15)?
-            block_x = x & 0x0F;
-            tile_px = block_x & 0x07;  // Pixel col within 8x8 tile
-
-            // Select tile from 2x2 block
-            if (block_y < 8) {
-                tile = (block_x < 8) ? L2_TILE_TL : L2_TILE_TR;
-            }
-            else {
-                tile = (block_x < 8) ? L2_TILE_BL : L2_TILE_BR;
-            }
+        block_row = block + (((start_y + y) & 0x0F) << 4);
 
-            // Get palette index and convert to RGB332
-            pal_idx = get_tile_pixel(tile, tile_px, tile_py);
-            row[x] = zx_to_rgb332[pal_idx];
+        for (rep = 0; rep < 16; rep++) {
+            memcpy(row, block_row, 16);
+            row += 16;
         }
     }
 
@@ -175,95 +231,98 @@ static void layer2_draw_8k_bank(uint8_t l2_bank, uint8_t start_y) {
     IO_NEXTREG_DAT = old_bank;
 }
 
-// Clear Layer 2 in 256x256 mode (8 banks instead of 6)
-static void layer2_clear_256(uint8_t color) {
-    uint8_t l2_bank;
-    uint16_t i;
-    uint8_t *ptr;
-    uint8_t old_bank;
-
-    // Save current MMU slot 2 bank
-    IO_NEXTREG_REG = MMU_SLOT2_REG;
-    old_bank = IO_NEXTREG_DAT;
-
-    // Clear all 8 8K banks (256 lines)
-    for (l2_bank = 16; l2_bank < 24; l2_bank++) {
-        IO_NEXTREG_REG = MMU_SLOT2_REG;
-        IO_NEXTREG_DAT = l2_bank;
+// Transpose the 16x16 block into l2_block_buf, one 16 byte run per
+// block column, for the column-major 320x256 layout
+static void layer2_block_columns(void) {
+    const uint8_t *block = layer2_get_block();
+    uint8_t px, py;
+    uint8_t *dst = l2_block_buf;
 
-        ptr = (uint8_t *)0x4000;
-        for (i = 0; i < 8192; i++) {
-            *ptr++ = color;
+    for (px = 0; px < 16; px++) {
+        for (py = 0; py < 16; py++) {
+            *dst++ = block[(py << 4) + px];
         }
     }
-
-    // Restore original bank
-    IO_NEXTREG_REG = MMU_SLOT2_REG;
-    IO_NEXTREG_DAT = old_bank;
 }
 
-// Draw a single 16x16 block at position (bx, by) - supports 256 height
-static void layer2_draw_block_256(uint8_t bx, uint8_t by) {
-    uint8_t px, py;
-    uint8_t tile_px, tile_py;
-    const uint8_t *tile;
-    uint8_t pal_idx;
-    uint8_t screen_x, screen_y;
-    uint8_t l2_bank;
-    uint8_t *ptr;
+// Fill one group of L2_JOB_COLS_PER_STEP columns of the 320x256 draw
+// buffer with the 2x2 tile block pattern or a random star field
+// 320x256 is column-major: offset = x * 256 + y, each 8K bank holds
+// 32 columns. The pattern repeats every 16 pixels, which divides both
+// 256 and 320, so scrolling wraps without a seam. Stars are single
+// pixels on black, so the seams between copper scroll bands (see
+// copper.c) are invisible.
+static void layer2_fill_320_cols(uint8_t group, uint8_t mode) {
+    static const uint8_t star_colors[4] = { 0xFF, 0xB6, 0x6D, 0x4B };
+    uint8_t first = (group % L2_JOB_COL_GROUPS) * L2_JOB_COLS_PER_STEP;
+    uint8_t col, rep, i;
+    uint8_t *column = (uint8_t *)0x4000 + ((uint16_t)first << 8);
+    uint8_t *dst;
+    uint16_t r;
     uint8_t old_bank;
 
+    if (mode == L2_WRAP_TILES) {
+        layer2_block_columns();
+    }
+
+    // Keep IM1 off Layer 2 while it is mapped at 0x4000
+    intrinsic_di();
+
     // Save current MMU slot 2 bank
     IO_NEXTREG_REG = MMU_SLOT2_REG;
     old_bank = IO_NEXTREG_DAT;
 
-    for (py = 0; py < 16; py++) {
-        screen_y = by + py;
-        tile_py = py & 0x07;
-
-        // Determine which 8K bank (each bank = 32 lines)
-        l2_bank = 16 + (screen_y / 32);
-
-        // Map the appropriate Layer 2 bank
-        IO_NEXTREG_REG = MMU_SLOT2_REG;
-        IO_NEXTREG_DAT = l2_bank;
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    IO_NEXTREG_DAT = l2_draw_bank + group / L2_JOB_COL_GROUPS;
 
-        for (px = 0; px < 16; px++) {
-            screen_x = bx + px;
-            tile_px = px & 0x07;
+    if (mode == L2_WRAP_STARS) {
+        memset(column, 0x00, L2_JOB_COLS_PER_STEP * 256);
 
-            // Select tile from 2x2 block
-            if (py < 8) {
-                tile = (px < 8) ? L2_TILE_TL : L2_TILE_TR;
-            } else {
-                tile = (px < 8) ? L2_TILE_BL : L2_TILE_BR;
+        // Column in the low bits of the high byte, line in the low byte
+        for (i = 0; i < L2_STARS_PER_STEP; i++) {
+            r = rng_next(RNG_LEVEL);
+            column[r & (L2_JOB_COLS_PER_STEP * 256 - 1)] = star_colors[(r >> 13) & 0x03];
+        }
+    }
+    else {
+        for (col = first; col < first + L2_JOB_COLS_PER_STEP; col++) {
+            // Bank width (32) is a multiple of 16, so col & 15 is x & 15
+            dst = column;
+            for (rep = 0; rep < 16; rep++) {
+                memcpy(dst, l2_block_buf + ((col & 0x0F) << 4), 16);
+                dst += 16;
             }
-
-            pal_idx = get_tile_pixel(tile, tile_px, tile_py);
-            ptr = (uint8_t *)0x4000 + ((screen_y % 32) * 256) + screen_x;
-            *ptr = zx_to_rgb332[pal_idx];
+            column += 256;
         }
     }
 
-    // Restore original bank
+    // Restore original bank before enabling interrupts
     IO_NEXTREG_REG = MMU_SLOT2_REG;
     IO_NEXTREG_DAT = old_bank;
+
+    intrinsic_ei();
 }
 
-// Draw border image from bank to Layer 2
-// Source data is in pages 40-41, we map one at a time to slot 3 (0x6000)
-// Destination is Layer 2 banks 16-21 mapped to slot 2 (0x4000)
-// mirror: 0 = normal, 1 = horizontally mirrored
-static void layer2_draw_border_from_bank(uint8_t x, uint8_t y, uint8_t mirror) {
-    uint8_t row, col;
-    uint8_t screen_y;
-    uint8_t l2_bank, last_l2_bank;
-    uint8_t src_page, last_src_page;
-    uint8_t *dst;
+// Draw a block image (header + map + dictionary) from a page to Layer 2
+// Source page is mapped to slot 3 (0x6000), Layer 2 banks to slot 2 (0x4000)
+// y must be a multiple of 8 so blocks never straddle a bank band
+// mirror: 0 = normal, 1 = horizontally mirrored (reuses the same blocks)
+// Only block rows first..first+count-1 are drawn (y stays the image top)
+static void layer2_draw_block_image(uint8_t page, uint8_t x, uint8_t y, uint8_t mirror,
+                                    uint8_t first, uint8_t count) {
+    const uint8_t *hdr = (const uint8_t *)0x6000;
+    const uint8_t *map;
+    const uint8_t *dict;
     const uint8_t *src;
+    uint8_t *dst;
+    uint8_t cols, rows;
+    uint8_t row, col, line, i;
+    uint8_t entry, dst_col, flip;
+    uint8_t screen_y;
     uint8_t old_slot2, old_slot3;
-    uint16_t src_offset;
-    uint8_t pixel;
+
+    // Keep IM1 off Layer 2 while it is mapped at 0x4000
+    intrinsic_di();
 
     // Save current MMU banks
     IO_NEXTREG_REG = MMU_SLOT2_REG;
@@ -271,76 +330,136 @@ static void layer2_draw_border_from_bank(uint8_t x, uint8_t y, uint8_t mirror) {
     IO_NEXTREG_REG = MMU_SLOT3_REG;
     old_slot3 = IO_NEXTREG_DAT;
 
-    last_l2_bank = 0xFF;
-    last_src_page = 0xFF;
-    src_offset = 0;
+    // Map block image page
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    IO_NEXTREG_DAT = page;
 
-    for (row = 0; row < BORDER_IMAGE_HEIGHT; row++) {
-        screen_y = y + row;
-        if (screen_y >= 192) break;
+    cols = hdr[BLOCK_HDR_COLS];
+    rows = hdr[BLOCK_HDR_ROWS];
+    map = hdr + BLOCK_HDR_SIZE;
+    dict = map + (uint16_t)cols * rows;
+    map += (uint16_t)first * cols;
 
-        // Determine destination Layer 2 bank (each bank = 32 lines)
-        l2_bank = 16 + (screen_y / 32);
+    for (row = first; row < rows && row < first + count; row++) {
+        screen_y = y + (row << 3);
+        if (screen_y >= L2_HEIGHT) break;
 
-        // Remap destination bank if changed
-        if (l2_bank != last_l2_bank) {
-            IO_NEXTREG_REG = MMU_SLOT2_REG;
-            IO_NEXTREG_DAT = l2_bank;
-            last_l2_bank = l2_bank;
+        // Map destination bank once per block row
+        IO_NEXTREG_REG = MMU_SLOT2_REG;
+        IO_NEXTREG_DAT = l2_draw_bank + (screen_y / L2_BAND_LINES);
+
+        for (col = 0; col < cols; col++) {
+            entry = *map++;
+            dst_col = mirror ? (cols - 1 - col) : col;
+            flip = ((entry & BLOCK_MAP_MIRROR) ? 1 : 0) ^ mirror;
+            src = dict + ((uint16_t)(entry & ~BLOCK_MAP_MIRROR) << 6);
+            dst = L2_ROW_ADDR(screen_y) + x + (dst_col << 3);
+
+            for (line = 0; line < 8; line++) {
+                if (flip) {
+                    for (i = 0; i < 8; i++) {
+                        dst[i] = src[7 - i];
+                    }
+                }
+                else {
+                    memcpy(dst, src, 8);
+                }
+                src += 8;
+                dst += 256;
+            }
         }
+    }
 
-        dst = (uint8_t *)0x4000 + ((screen_y % 32) * 256) + x;
+    // Restore original banks before enabling interrupts
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    IO_NEXTREG_DAT = old_slot2;
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    IO_NEXTREG_DAT = old_slot3;
 
-        // Copy row pixel by pixel, handling page boundary mid-row
-        for (col = 0; col < BORDER_IMAGE_WIDTH; col++) {
-            // Check if we need to switch source page
-            src_page = 40 + (src_offset / 8192);
-            if (src_page != last_src_page) {
-                IO_NEXTREG_REG = MMU_SLOT3_REG;
-                IO_NEXTREG_DAT = src_page;
-                last_src_page = src_page;
-            }
+    intrinsic_ei();
+}
 
-            // Read pixel from source
-            src = (const uint8_t *)0x6000 + (src_offset % 8192);
-            pixel = *src;
-            src_offset++;
+// Decompress an LZ image from banked pages straight into Layer 2
+// page: first page of the image (holds the chunk directory)
+// Each chunk fills one 8K Layer 2 bank (32 lines) of the draw buffer
+void layer2_draw_lz_image(uint8_t page) {
+    uint8_t dir[1 + LZ_MAX_CHUNKS * LZ_DIR_ENTRY_SIZE];
+    const uint8_t *entry;
+    uint8_t count, i;
+    uint8_t old_slot2, old_slot3;
 
-            // Write to destination (handle mirror)
-            if (mirror) {
-                dst[BORDER_IMAGE_WIDTH - 1 - col] = pixel;
-            } else {
-                dst[col] = pixel;
-            }
-        }
+    // Disable interrupts while Layer 2 is mapped at 0x4000
+    intrinsic_di();
+
+    // Save current MMU banks
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    old_slot2 = IO_NEXTREG_DAT;
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    old_slot3 = IO_NEXTREG_DAT;
+
+    // Copy directory out of the page, slot 3 is remapped per chunk
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    IO_NEXTREG_DAT = page;
+    count = *(const uint8_t *)0x6000;
+    if (count > LZ_MAX_CHUNKS) count = LZ_MAX_CHUNKS;
+    memcpy(dir, (const uint8_t *)0x6000, 1 + count * LZ_DIR_ENTRY_SIZE);
+
+    entry = dir + 1;
+    for (i = 0; i < count; i++) {
+        IO_NEXTREG_REG = MMU_SLOT2_REG;
+        IO_NEXTREG_DAT = l2_draw_bank + i;
+        IO_NEXTREG_REG = MMU_SLOT3_REG;
+        IO_NEXTREG_DAT = entry[0];
+
+        lz_unpack((const uint8_t *)0x6000 + (entry[1] | ((uint16_t)entry[2] << 8)),
+                  (uint8_t *)0x4000);
+        entry += LZ_DIR_ENTRY_SIZE;
     }
 
-    // Restore original banks
+    // Restore original banks before enabling interrupts
     IO_NEXTREG_REG = MMU_SLOT2_REG;
     IO_NEXTREG_DAT = old_slot2;
     IO_NEXTREG_REG = MMU_SLOT3_REG;
     IO_NEXTREG_DAT = old_slot3;
+
+    intrinsic_ei();
 }
 
-// Initialize Layer 2 with white background and border images (256x192 mode)
+// Initialize Layer 2 (256x192 mode)
+// The background is pre-composed at build time and stored LZ compressed
+// (layer2_background_lz.asm, 4K instead of 48K of NEX), then unpacked
+// into banks 16-21 here.
 void layer2_init(void) {
-    // Disable interrupts during bank manipulation to prevent
-    // IM1 handler from corrupting Layer 2 memory at 0x4000
-    intrinsic_di();
-
     // Set Layer 2 RAM to start at bank 16 (8K banks)
     // Register 0x12 uses 16K bank number, so 16K bank 8 = 8K banks 16-17
     IO_NEXTREG_REG = 0x12;
     IO_NEXTREG_DAT = 8;
 
-    // Fill with black background (256x192 = 6 banks)
-    layer2_clear(0x00);
+    // Single buffered: draw to the displayed banks
+    l2_front_bank = L2_FIRST_BANK;
+    l2_draw_bank = L2_FIRST_BANK;
+    l2_double_buffered = 0;
+    l2_flip_pending = 0;
+    l2_single_after_flip = 0;
+    l2_flip_wrap = L2_WRAP_OFF;
+    l2_bank_count = L2_BANK_COUNT;
+    l2_wrap_mode = L2_WRAP_OFF;
 
-    // Draw left border image from bank 40
-    layer2_draw_border_from_bank(0, 0, 0);
+    // 4-bit tile expansion table for tile/block drawing
+    layer2_build_nibble_cache();
 
-    // Draw right border image mirrored
-    layer2_draw_border_from_bank(256 - BORDER_IMAGE_WIDTH, 0, 1);
+    layer2_draw_lz_image(BACKGROUND_LZ_PAGE);
+}
+
+// Redraw the background at runtime (black fill + border images)
+// Only needed if the Layer 2 banks were overwritten after load
+void layer2_draw_background(void) {
+    // Disable interrupts during bank manipulation to prevent
+    // IM1 handler from corrupting Layer 2 memory at 0x4000
+    intrinsic_di();
+
+    // Fill with black background (256x192 = 6 banks)
+    layer2_clear(0x00);
 
     // Restore MMU slot 2 before enabling interrupts
     IO_NEXTREG_REG = MMU_SLOT2_REG;
@@ -348,16 +467,174 @@ void layer2_init(void) {
 
     // Now safe to enable interrupts
     intrinsic_ei();
+
+    // Draw left border image from page 40 (block images disable
+    // interrupts themselves)
+    layer2_draw_block_image(BORDER_BLOCKS_PAGE, 0, 0, 0, 0, 0xFF);
+
+    // Draw right border image mirrored from the same blocks
+    layer2_draw_block_image(BORDER_BLOCKS_PAGE, 256 - BORDER_BLOCKS_WIDTH, 0, 1, 0, 0xFF);
+}
+
+// Copy the displayed buffer into the back buffer (8K bank at a time)
+// Front bank is mapped to slot 3 (0x6000), back bank to slot 2 (0x4000)
+static void layer2_copy_front_to_back(void) {
+    uint8_t i;
+    uint8_t old_slot2, old_slot3;
+
+    intrinsic_di();
+
+    // Save current MMU banks
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    old_slot2 = IO_NEXTREG_DAT;
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    old_slot3 = IO_NEXTREG_DAT;
+
+    for (i = 0; i < l2_bank_count; i++) {
+        IO_NEXTREG_REG = MMU_SLOT2_REG;
+        IO_NEXTREG_DAT = l2_draw_bank + i;
+        IO_NEXTREG_REG = MMU_SLOT3_REG;
+        IO_NEXTREG_DAT = l2_front_bank + i;
+        memcpy((uint8_t *)0x4000, (const uint8_t *)0x6000, 8192);
+    }
+
+    // Restore original banks before enabling interrupts
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    IO_NEXTREG_DAT = old_slot2;
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    IO_NEXTREG_DAT = old_slot3;
+
+    intrinsic_ei();
+}
+
+// Draw to whichever bank set is not displayed (contents are left as is)
+static void layer2_use_back_buffer(void) {
+    l2_draw_bank = (l2_front_bank == L2_FIRST_BANK) ? L2_SHADOW_BANK : L2_FIRST_BANK;
+
+    // Register 0x13: Layer 2 shadow RAM bank (16K bank number)
+    IO_NEXTREG_REG = 0x13;
+    IO_NEXTREG_DAT = l2_draw_bank >> 1;
+
+    l2_double_buffered = 1;
+}
+
+// Draw straight to the displayed buffer again, dropping any pending flip
+static void layer2_single_buffer(void) {
+    l2_draw_bank = l2_front_bank;
+    l2_double_buffered = 0;
+    l2_flip_pending = 0;
+    l2_single_after_flip = 0;
+    l2_flip_wrap = l2_wrap_mode;
+}
+
+// Enable/disable double buffering
+// Enabling copies the displayed image into the back buffer so both start equal
+void layer2_set_double_buffer(uint8_t enable) {
+    if (enable) {
+        if (l2_double_buffered) return;
+
+        layer2_use_back_buffer();
+        layer2_copy_front_to_back();
+
+        l2_flip_pending = 0;
+        l2_single_after_flip = 0;
+    }
+    else {
+        if (!l2_double_buffered) return;
+
+        // A presented frame is still hidden: switch after the flip
+        if (l2_flip_pending) {
+            l2_single_after_flip = 1;
+            return;
+        }
+        layer2_single_buffer();
+    }
+}
+
+// Program resolution, clip window and X scroll MSB for a wrap mode
+// Called at the flip that shows a backdrop built for that mode
+// Wrap mode (L2_WRAP_TILES / L2_WRAP_STARS) is 320x256 clipped to the
+// 256x192 game area; scrolling is then a plain 8-bit write.
+static void layer2_apply_wrap_mode(uint8_t mode) {
+    l2_wrap_mode = mode;
+
+    // Reset Layer 2 clip window index (reg 0x1C bit 0)
+    ZXN_NEXTREG(0x1C, 0x01);
+
+    if (mode != L2_WRAP_OFF) {
+        l2_bank_count = L2_WRAP_BANK_COUNT;
+
+        // Register 0x70: Layer 2 control, bits 5-4 = 01 for 320x256
+        ZXN_NEXTREG(0x70, 0x10);
+
+        // Clip to 256x192 game area (X is in 2-pixel units in 320 mode)
+        ZXN_NEXTREG(0x18, 16);    // X1 = 32 / 2
+        ZXN_NEXTREG(0x18, 143);   // X2 = 287 / 2
+        ZXN_NEXTREG(0x18, 32);    // Y1
+        ZXN_NEXTREG(0x18, 223);   // Y2
+    }
+    else {
+        l2_bank_count = L2_BANK_COUNT;
+
+        // Back to 256x192, full clip window, no X scroll MSB
+        ZXN_NEXTREG(0x70, 0x00);
+        ZXN_NEXTREG(0x71, 0x00);
+        ZXN_NEXTREG(0x18, 0);
+        ZXN_NEXTREG(0x18, 255);
+        ZXN_NEXTREG(0x18, 0);
+        ZXN_NEXTREG(0x18, 191);
+
+        // A wrap mode Y scroll may point past line 191
+        l2_scroll_y %= L2_HEIGHT;
+        IO_NEXTREG_REG = 0x17;
+        IO_NEXTREG_DAT = l2_scroll_y;
+    }
+}
+
+// Mark the back buffer as complete; shown at the next layer2_vblank()
+void layer2_present(void) {
+    if (l2_double_buffered) {
+        l2_flip_pending = 1;
+    }
+}
+
+// Call once per frame right after the vertical blank halt
+// Swaps front and back buffers if a finished frame is waiting
+void layer2_vblank(void) {
+    uint8_t old_front;
+
+    if (!l2_flip_pending) return;
+
+    old_front = l2_front_bank;
+    l2_front_bank = l2_draw_bank;
+    l2_draw_bank = old_front;
+
+    // Register 0x12: displayed bank, 0x13: shadow bank (16K bank numbers)
+    IO_NEXTREG_REG = 0x12;
+    IO_NEXTREG_DAT = l2_front_bank >> 1;
+    IO_NEXTREG_REG = 0x13;
+    IO_NEXTREG_DAT = l2_draw_bank >> 1;
+
+    l2_flip_pending = 0;
+
+    // A backdrop from the background job may bring a new resolution
+    if (l2_flip_wrap != l2_wrap_mode) {
+        layer2_apply_wrap_mode(l2_flip_wrap);
+    }
+
+    if (l2_single_after_flip) {
+        layer2_single_buffer();
+    }
 }
 
 // Enable Layer 2 display
 void layer2_enable(void) {
-    // Register 0x69: Layer 2 Control
+    // Register 0x69: Display Control 1
     // Bit 7: Layer 2 enable
-    // Bit 6: Layer 2 shadow (0 = use bank in reg 0x12)
-    // Bits 5-4: Resolution (00 = 256x192, 01 = 320x256, 10 = 640x256, 11 = 256x256)
-    // Bits 3-0: Palette offset
-    ZXN_NEXTREG(0x69, 0x80);  // Enable Layer 2, 256x192 mode (bits 5-4 = 00)
+    // Bit 6: ULA shadow screen (0 = bank 5)
+    // Bits 5-0: Timex mode (0)
+    // Resolution is set separately in register 0x70 (see layer2_set_wrap_mode)
+    ZXN_NEXTREG(0x69, 0x80);  // Enable Layer 2
 }
 
 // Disable Layer 2 display
@@ -366,22 +643,85 @@ void layer2_disable(void) {
     ZXN_NEXTREG(0x69, 0x00);  // Disable Layer 2
 }
 
+// Switch between 256x192 (border art) and 320x256 wrap mode at once
+// Runs the background job for the matching backdrop to completion and
+// flips it in immediately, so it blocks for the whole build. Use
+// layer2_bg_job_start() to spread the same work over frames.
+void layer2_set_wrap_mode(uint8_t mode) {
+    uint8_t double_buffered = l2_double_buffered;
+
+    if (mode == l2_wrap_mode) return;
+
+    layer2_bg_job_start((mode == L2_WRAP_TILES) ? L2_BG_TILES :
+                        (mode == L2_WRAP_STARS) ? L2_BG_STARS : L2_BG_BORDER);
+    while (layer2_bg_job_step()) {
+    }
+    layer2_vblank();
+
+    // Back to the buffering the caller had (the back buffer is stale)
+    layer2_single_buffer();
+    if (double_buffered) {
+        layer2_set_double_buffer(1);
+    }
+}
+
 // Scroll Layer 2 vertically (parallax background - half speed)
 // Wraps within 0-191 range to avoid jump in 256x192 mode
+// In wrap mode the 256 line buffer wraps in hardware, no modulo needed
 void layer2_scroll(int16_t offset_y) {
+    if (l2_wrap_mode) {
+        l2_scroll_y = (uint8_t)(-offset_y);
+        IO_NEXTREG_REG = 0x17;
+        IO_NEXTREG_DAT = l2_scroll_y;
+        return;
+    }
+
     // Wrap to 0-191 range for 256x192 mode
     // Use 192 - (offset % 192) to match tilemap scroll direction
     int16_t wrapped = offset_y % 192;
     if (wrapped < 0) wrapped += 192;
     uint8_t scroll = (uint8_t)((192 - wrapped) % 192);
+    l2_scroll_y = scroll;
     IO_NEXTREG_REG = 0x17;
     IO_NEXTREG_DAT = scroll;
 }
 
 // Scroll Layer 2 horizontally
+// In wrap mode the buffer is 320 wide: the offset is folded into 0-319
+// and bit 8 goes to register 0x71
 void layer2_scroll_x(int16_t offset_x) {
+    int16_t wrapped;
+
+    if (l2_wrap_mode) {
+        wrapped = offset_x % 320;
+        if (wrapped < 0) wrapped += 320;
+        IO_NEXTREG_REG = 0x71;
+        IO_NEXTREG_DAT = (uint8_t)(wrapped >> 8);
+        offset_x = wrapped;
+    }
+
+    l2_scroll_x = (uint8_t)(offset_x & 0xFF);
     IO_NEXTREG_REG = 0x16;
-    IO_NEXTREG_DAT = (uint8_t)(offset_x & 0xFF);
+    IO_NEXTREG_DAT = l2_scroll_x;
+}
+
+// Wrap mode of the displayed buffer
+uint8_t layer2_get_wrap_mode(void) {
+    return l2_wrap_mode;
+}
+
+// Drawing goes straight to the displayed 256x192 buffer
+uint8_t layer2_is_direct(void) {
+    return !l2_wrap_mode && !l2_double_buffered && l2_job_phase == L2_JOB_IDLE;
+}
+
+// Current scroll register values (buffer line/column shown at screen 0,0)
+uint8_t layer2_get_scroll_x(void) {
+    return l2_scroll_x;
+}
+
+uint8_t layer2_get_scroll_y(void) {
+    return l2_scroll_y;
 }
 
 // Clear Layer 2 with a color
@@ -396,7 +736,7 @@ void layer2_clear(uint8_t color) {
     old_bank = IO_NEXTREG_DAT;
 
     // Clear all 6 8K banks
-    for (l2_bank = 16; l2_bank < 22; l2_bank++) {
+    for (l2_bank = l2_draw_bank; l2_bank < l2_draw_bank + L2_BANK_COUNT; l2_bank++) {
         IO_NEXTREG_REG = MMU_SLOT2_REG;
         IO_NEXTREG_DAT = l2_bank;
 
@@ -419,12 +759,15 @@ void layer2_plot(uint8_t x, uint8_t y, uint8_t color) {
 
     if (y >= 192) return;
 
+    // Keep IM1 off Layer 2 while it is mapped at 0x4000
+    intrinsic_di();
+
     // Save current MMU slot 2 bank
     IO_NEXTREG_REG = MMU_SLOT2_REG;
     old_bank = IO_NEXTREG_DAT;
 
     // Determine which 8K bank (each bank = 32 lines)
-    l2_bank = 16 + (y / 32);
+    l2_bank = l2_draw_bank + (y / 32);
 
     // Map the appropriate Layer 2 bank
     IO_NEXTREG_REG = MMU_SLOT2_REG;
@@ -434,33 +777,332 @@ void layer2_plot(uint8_t x, uint8_t y, uint8_t color) {
     ptr = (uint8_t *)0x4000 + ((y % 32) * 256) + x;
     *ptr = color;
 
-    // Restore original bank
+    // Restore original bank before enabling interrupts
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    IO_NEXTREG_DAT = old_bank;
+
+    intrinsic_ei();
+}
+
+// Fill a span of rows, mapping each 32-line bank only once
+// w is 16-bit so a full 256 pixel row fits
+static void layer2_fill_span(uint8_t x, uint8_t y, uint16_t w, uint8_t h, uint8_t color) {
+    uint8_t rows;
+    uint8_t *row;
+    uint8_t old_bank;
+
+    // Clip to screen (no horizontal wrap)
+    if (w == 0 || h == 0 || y >= L2_HEIGHT) return;
+    if (x + w > 256) w = 256 - x;
+    if (y + h > L2_HEIGHT) h = L2_HEIGHT - y;
+
+    // Keep IM1 off Layer 2 while it is mapped at 0x4000
+    intrinsic_di();
+
+    // Save current MMU slot 2 bank
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    old_bank = IO_NEXTREG_DAT;
+
+    while (h > 0) {
+        // Rows left in this bank band
+        rows = L2_BAND_LINES - (y & (L2_BAND_LINES - 1));
+        if (rows > h) rows = h;
+
+        IO_NEXTREG_REG = MMU_SLOT2_REG;
+        IO_NEXTREG_DAT = l2_draw_bank + (y / L2_BAND_LINES);
+
+        row = L2_ROW_ADDR(y) + x;
+        y += rows;
+        h -= rows;
+
+        while (rows--) {
+            memset(row, color, w);
+            row += 256;
+        }
+    }
+
+    // Restore original bank before enabling interrupts
     IO_NEXTREG_REG = MMU_SLOT2_REG;
     IO_NEXTREG_DAT = old_bank;
+
+    intrinsic_ei();
 }
 
 // Draw horizontal line
 void layer2_hline(uint8_t x1, uint8_t x2, uint8_t y, uint8_t color) {
-    uint8_t x;
-    for (x = x1; x <= x2; x++) {
-        layer2_plot(x, y, color);
-    }
+    if (x2 < x1) return;
+    layer2_fill_span(x1, y, (uint16_t)(x2 - x1) + 1, 1, color);
 }
 
 // Draw vertical line
 void layer2_vline(uint8_t x, uint8_t y1, uint8_t y2, uint8_t color) {
-    uint8_t y;
-    for (y = y1; y <= y2; y++) {
-        layer2_plot(x, y, color);
+    uint8_t rows;
+    uint8_t *ptr;
+    uint8_t old_bank;
+
+    if (y2 < y1 || y1 >= L2_HEIGHT) return;
+    if (y2 >= L2_HEIGHT) y2 = L2_HEIGHT - 1;
+
+    // Keep IM1 off Layer 2 while it is mapped at 0x4000
+    intrinsic_di();
+
+    // Save current MMU slot 2 bank
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    old_bank = IO_NEXTREG_DAT;
+
+    while (y1 <= y2) {
+        // Rows left in this bank band
+        rows = L2_BAND_LINES - (y1 & (L2_BAND_LINES - 1));
+        if (rows > y2 - y1 + 1) rows = y2 - y1 + 1;
+
+        IO_NEXTREG_REG = MMU_SLOT2_REG;
+        IO_NEXTREG_DAT = l2_draw_bank + (y1 / L2_BAND_LINES);
+
+        ptr = L2_ROW_ADDR(y1) + x;
+        y1 += rows;
+
+        while (rows--) {
+            *ptr = color;
+            ptr += 256;
+        }
     }
+
+    // Restore original bank before enabling interrupts
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    IO_NEXTREG_DAT = old_bank;
+
+    intrinsic_ei();
 }
 
 // Fill rectangle
 void layer2_fill_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color) {
-    uint8_t i, j;
-    for (j = 0; j < h; j++) {
-        for (i = 0; i < w; i++) {
-            layer2_plot(x + i, y + j, color);
+    layer2_fill_span(x, y, w, h, color);
+}
+
+// Copy a w x h RGB332 image to Layer 2, band by band
+// stride: bytes between source rows (w for a whole image)
+// transparent: colour index to skip, or L2_OPAQUE for a plain copy
+void layer2_blit_sub(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                     const uint8_t *src, uint8_t stride, uint16_t transparent) {
+    uint8_t rows;
+    uint8_t cw;
+    uint8_t i;
+    uint8_t pixel;
+    uint8_t *row;
+    uint8_t old_bank;
+
+    // Clip to screen (no horizontal wrap), source stride is unchanged
+    if (w == 0 || h == 0 || y >= L2_HEIGHT) return;
+    cw = w;
+    if (x + cw > 256) cw = (uint8_t)(256 - x);
+    if (y + h > L2_HEIGHT) h = L2_HEIGHT - y;
+
+    // Keep IM1 off Layer 2 while it is mapped at 0x4000
+    intrinsic_di();
+
+    // Save current MMU slot 2 bank
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    old_bank = IO_NEXTREG_DAT;
+
+    while (h > 0) {
+        // Rows left in this bank band
+        rows = L2_BAND_LINES - (y & (L2_BAND_LINES - 1));
+        if (rows > h) rows = h;
+
+        IO_NEXTREG_REG = MMU_SLOT2_REG;
+        IO_NEXTREG_DAT = l2_draw_bank + (y / L2_BAND_LINES);
+
+        row = L2_ROW_ADDR(y) + x;
+        y += rows;
+        h -= rows;
+
+        while (rows--) {
+            if (transparent == L2_OPAQUE) {
+                memcpy(row, src, cw);
+            }
+            else {
+                for (i = 0; i < cw; i++) {
+                    pixel = src[i];
+                    if (pixel != (uint8_t)transparent) row[i] = pixel;
+                }
+            }
+            src += stride;
+            row += 256;
         }
     }
+
+    // Restore original bank before enabling interrupts
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    IO_NEXTREG_DAT = old_bank;
+
+    intrinsic_ei();
+}
+
+// Copy a w x h rectangle from Layer 2 into dst (reverse of layer2_blit_sub)
+// Used to save background before drawing over it
+void layer2_read_sub(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *dst, uint8_t stride) {
+    uint8_t rows;
+    uint8_t cw;
+    const uint8_t *row;
+    uint8_t old_bank;
+
+    // Clip to screen (no horizontal wrap), destination stride is unchanged
+    if (w == 0 || h == 0 || y >= L2_HEIGHT) return;
+    cw = w;
+    if (x + cw > 256) cw = (uint8_t)(256 - x);
+    if (y + h > L2_HEIGHT) h = L2_HEIGHT - y;
+
+    // Keep IM1 off Layer 2 while it is mapped at 0x4000
+    intrinsic_di();
+
+    // Save current MMU slot 2 bank
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    old_bank = IO_NEXTREG_DAT;
+
+    while (h > 0) {
+        // Rows left in this bank band
+        rows = L2_BAND_LINES - (y & (L2_BAND_LINES - 1));
+        if (rows > h) rows = h;
+
+        IO_NEXTREG_REG = MMU_SLOT2_REG;
+        IO_NEXTREG_DAT = l2_draw_bank + (y / L2_BAND_LINES);
+
+        row = L2_ROW_ADDR(y) + x;
+        y += rows;
+        h -= rows;
+
+        while (rows--) {
+            memcpy(dst, row, cw);
+            dst += stride;
+            row += 256;
+        }
+    }
+
+    // Restore original bank before enabling interrupts
+    IO_NEXTREG_REG = MMU_SLOT2_REG;
+    IO_NEXTREG_DAT = old_bank;
+
+    intrinsic_ei();
+}
+
+// Copy a whole rectangle out of Layer 2
+void layer2_read_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *dst) {
+    layer2_read_sub(x, y, w, h, dst, w);
+}
+
+// Blit an opaque image
+void layer2_blit(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *src) {
+    layer2_blit_sub(x, y, w, h, src, w, L2_OPAQUE);
+}
+
+// Blit an image, skipping pixels equal to transparent
+void layer2_blit_masked(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                        const uint8_t *src, uint8_t transparent) {
+    layer2_blit_sub(x, y, w, h, src, w, transparent);
+}
+
+// Start building a backdrop in the background job
+// The job draws into the back buffer from scratch (no front to back copy)
+// while the old backdrop stays on screen, then presents it; the flip at
+// the next layer2_vblank() also switches the wrap mode if it changes.
+// L2_BG_BLOCKS clears to black and scatters 2x2 tile blocks over
+// L2_BLOCK_COVERAGE percent of the screen, L2_BG_BORDER clears and draws
+// the border art a block row at a time, and L2_BG_TILES / L2_BG_STARS
+// fill the 320x256 buffer 8 columns at a time.
+// A job started while another is running or waiting for its flip
+// replaces it.
+void layer2_bg_job_start(uint8_t backdrop) {
+    if (!l2_double_buffered) {
+        layer2_use_back_buffer();
+    }
+    l2_flip_pending = 0;
+    l2_single_after_flip = 0;
+    l2_flip_wrap = l2_wrap_mode;
+
+    l2_job_backdrop = backdrop;
+    l2_job_pos = 0;
+
+    switch (backdrop) {
+        case L2_BG_TILES:
+            l2_job_wrap = L2_WRAP_TILES;
+            l2_job_phase = L2_JOB_FILL;
+            break;
+
+        case L2_BG_STARS:
+            l2_job_wrap = L2_WRAP_STARS;
+            l2_job_phase = L2_JOB_FILL;
+            break;
+
+        default:  // L2_BG_BORDER, L2_BG_BLOCKS
+            l2_job_wrap = L2_WRAP_OFF;
+            l2_job_blocks = (uint8_t)((uint16_t)L2_BLOCK_SLOTS * L2_BLOCK_COVERAGE / 100);
+            l2_job_phase = L2_JOB_CLEAR;
+            break;
+    }
+}
+
+// Abandon a running background job (the back buffer is left half drawn)
+void layer2_bg_job_stop(void) {
+    l2_job_phase = L2_JOB_IDLE;
+}
+
+// Run one bounded slice of the background job
+// Call once per frame in idle time after game_render
+// Returns 1 while the job is still running
+uint8_t layer2_bg_job_step(void) {
+    uint8_t n;
+    uint16_t r;
+
+    switch (l2_job_phase) {
+        case L2_JOB_IDLE:
+            return 0;
+
+        case L2_JOB_CLEAR:
+            layer2_fill_span(0, l2_job_pos, 256, L2_JOB_ROWS_PER_STEP, 0x00);
+            l2_job_pos += L2_JOB_ROWS_PER_STEP;
+            if (l2_job_pos >= L2_HEIGHT) {
+                l2_job_pos = 0;
+                l2_job_phase = (l2_job_backdrop == L2_BG_BORDER) ? L2_JOB_BORDER : L2_JOB_BLOCKS;
+            }
+            break;
+
+        case L2_JOB_BLOCKS:
+            for (n = 0; n < L2_JOB_BLOCKS_PER_STEP && l2_job_blocks > 0; n++) {
+                // Random block position on the 16x12 block grid
+                r = rng_next(RNG_LEVEL);
+                layer2_draw_block((uint8_t)(r >> 8) & 0xF0,
+                                  (uint8_t)(((uint8_t)(r >> 4) % 12) << 4));
+                l2_job_blocks--;
+            }
+            if (l2_job_blocks == 0) {
+                l2_job_phase = L2_JOB_IDLE;
+            }
+            break;
+
+        case L2_JOB_BORDER:
+            // One 8 line block row of the left border and its mirror
+            layer2_draw_block_image(BORDER_BLOCKS_PAGE, 0, 0, 0, l2_job_pos >> 3, 1);
+            layer2_draw_block_image(BORDER_BLOCKS_PAGE, 256 - BORDER_BLOCKS_WIDTH, 0, 1,
+                                    l2_job_pos >> 3, 1);
+            l2_job_pos += 8;
+            if (l2_job_pos >= L2_HEIGHT) {
+                l2_job_phase = L2_JOB_IDLE;
+            }
+            break;
+
+        default:  // L2_JOB_FILL
+            layer2_fill_320_cols(l2_job_pos, l2_job_wrap);
+            if (++l2_job_pos == L2_JOB_FILL_STEPS) {
+                l2_job_phase = L2_JOB_IDLE;
+            }
+            break;
+    }
+
+    if (l2_job_phase == L2_JOB_IDLE) {
+        // Finished: show it at the next vblank, in its wrap mode
+        l2_flip_wrap = l2_job_wrap;
+        layer2_present();
+        return 0;
+    }
+    return 1;
 }
@@ -3,17 +3,69 @@
 
 #include <stdint.h>
 
-// Initialize Layer 2 with blue grid background
+// Initialize Layer 2 and unpack the composed background into banks 16-21
 void layer2_init(void);
 
+// Redraw the background from the border image at runtime
+void layer2_draw_background(void);
+
+// Decompress an LZ image (tools/png_to_asm.py --lz) starting at page
+void layer2_draw_lz_image(uint8_t page);
+
 // Enable/disable Layer 2 display
 void layer2_enable(void);
 void layer2_disable(void);
 
+// Double buffering (shadow bank via register 0x13, flipped at vblank)
+// While enabled all drawing goes to the hidden back buffer. Call
+// layer2_present() when a frame is finished (may take several frames)
+// and layer2_vblank() right after each vblank halt to perform the flip.
+// After a flip the new back buffer holds the frame before last.
+// Disabling while a presented frame is pending waits for that flip.
+void layer2_set_double_buffer(uint8_t enable);
+void layer2_present(void);
+void layer2_vblank(void);
+
+// Seamless wrap mode: 320x256 Layer 2 filled with a 16 pixel tile pattern
+// or a star field, clipped to 256x192. Vertical scroll becomes a plain
+// 8-bit register write. layer2_set_wrap_mode() builds and shows the new
+// backdrop in one blocking call; layer2_get_wrap_mode() is the mode on
+// screen, which a background job changes at its flip.
+#define L2_WRAP_OFF    0
+#define L2_WRAP_TILES  1
+#define L2_WRAP_STARS  2
+void layer2_set_wrap_mode(uint8_t mode);
+uint8_t layer2_get_wrap_mode(void);
+
+// Incremental backdrop builder
+// layer2_bg_job_start() builds a backdrop in the back buffer while the
+// old one stays on screen; layer2_bg_job_step() does a bounded slice
+// (about 2K of writes) per call and returns 1 while busy, call it once
+// per frame after game_render. When done the backdrop is presented, and
+// the flip in layer2_vblank() also switches resolution for wrap mode
+// backdrops. Double buffering stays on afterwards; turn it off with
+// layer2_set_double_buffer(0) once the job is idle.
+// layer2_bg_job_stop() abandons a running job.
+#define L2_BG_BORDER   0   // Border art, 256x192
+#define L2_BG_BLOCKS   1   // Random tile block scatter on black, 256x192
+#define L2_BG_TILES    2   // Tile pattern, 320x256 wrap mode
+#define L2_BG_STARS    3   // Star field, 320x256 wrap mode
+void layer2_bg_job_start(uint8_t backdrop);
+void layer2_bg_job_stop(void);
+uint8_t layer2_bg_job_step(void);
+
 // Scroll Layer 2
 void layer2_scroll(int16_t offset_y);
 void layer2_scroll_x(int16_t offset_x);
 
+// 1 when drawing goes straight to the displayed 256x192 buffer: single
+// buffered, not in wrap mode and no background job running (overlay.c)
+uint8_t layer2_is_direct(void);
+
+// Current scroll register values (buffer column/line shown at screen 0,0)
+uint8_t layer2_get_scroll_x(void);
+uint8_t layer2_get_scroll_y(void);
+
 // Drawing functions
 void layer2_clear(uint8_t color);
 void layer2_plot(uint8_t x, uint8_t y, uint8_t color);
@@ -21,4 +73,23 @@ void layer2_hline(uint8_t x1, uint8_t x2, uint8_t y, uint8_t color);
 void layer2_vline(uint8_t x, uint8_t y1, uint8_t y2, uint8_t color);
 void layer2_fill_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color);
 
+// Span drawing: lines, rects and blits are split into 32-line bank bands,
+// each bank is mapped once and rows are written with block copies.
+// Shapes are clipped to 256x192. Blit source must not live in 0x4000-0x5FFF.
+// Each call disables interrupts while a bank is mapped and restores slot 2
+// before enabling them again, so they end with interrupts enabled.
+void layer2_blit(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *src);
+void layer2_blit_masked(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                        const uint8_t *src, uint8_t transparent);
+
+// Copy a rectangle out of Layer 2 (dst stride = w)
+void layer2_read_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *dst);
+
+// Sub-image variants: rows are stride bytes apart in the memory buffer
+// transparent is a colour to skip, or L2_OPAQUE for a plain copy
+#define L2_OPAQUE  0x100
+void layer2_blit_sub(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                     const uint8_t *src, uint8_t stride, uint16_t transparent);
+void layer2_read_sub(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *dst, uint8_t stride);
+
 #endif // LAYER2_H
@@ -0,0 +1,282 @@
+; Generated from PNG: 256x192 pixels, 4413 bytes
+; Pages: 42-42
+
+SECTION PAGE_42
+PUBLIC _layer2_bg_lz_page42
+_layer2_bg_lz_page42:
+    defb 0x06, 0x2a, 0x13, 0x00, 0x2a, 0x43, 0x02, 0x2a, 0x3c, 0x04, 0x2a, 0x56, 0x07, 0x2a, 0x31, 0x0b
+    defb 0x2a, 0x91, 0x0e, 0x1f, 0x00, 0x01, 0x00, 0x07, 0x11, 0x18, 0x02, 0x00, 0x0f, 0x01, 0x00, 0xac
+    defb 0x0f, 0xc5, 0x00, 0x28, 0x0f, 0x00, 0x01, 0xff, 0xd3, 0x0f, 0x1c, 0x00, 0x08, 0x0f, 0x00, 0x01
+    defb 0xd1, 0x0f, 0x1b, 0x01, 0x0b, 0x01, 0x3b, 0x00, 0x0f, 0x03, 0x01, 0xa8, 0x01, 0xbe, 0x00, 0x0f
+    defb 0x00, 0x02, 0x2d, 0x0f, 0x00, 0x01, 0xca, 0x1f, 0x18, 0x00, 0x03, 0x11, 0x0f, 0x02, 0x01, 0xa4
+    defb 0x03, 0xbc, 0x00, 0x0f, 0x00, 0x01, 0x0e, 0x4f, 0x18, 0x18, 0x00, 0x1b, 0x40, 0x00, 0x03, 0x0f
+    defb 0x00, 0x01, 0xc9, 0x14, 0x1b, 0xfc, 0x00, 0x2f, 0x18, 0x18, 0xfe, 0x00, 0x02, 0x07, 0x00, 0x03
+    defb 0x0f, 0x00, 0x01, 0xa6, 0x0f, 0x00, 0x03, 0x0b, 0x10, 0x1b, 0xfd, 0x00, 0x43, 0x1b, 0x00, 0x00
+    defb 0x1b, 0x00, 0x01, 0x0c, 0x27, 0x00, 0x0f, 0x00, 0x04, 0xc6, 0x03, 0x10, 0x00, 0x00, 0xf8, 0x00
+    defb 0x30, 0x1b, 0x1b, 0x18, 0x08, 0x00, 0x0f, 0x00, 0x03, 0x05, 0x01, 0x23, 0x02, 0x0f, 0x00, 0x02
+    defb 0xab, 0x00, 0xe5, 0x01, 0x0f, 0x1e, 0x00, 0x01, 0x10, 0x1b, 0xf8, 0x00, 0x40, 0x18, 0x1b, 0x18
+    defb 0x18, 0x04, 0x00, 0x0f, 0xe6, 0x01, 0x02, 0x03, 0x00, 0x01, 0x0f, 0x01, 0x00, 0xab, 0x0f, 0x00
+    defb 0x01, 0x04, 0x01, 0x1a, 0x01, 0x00, 0xfd, 0x00, 0x30, 0x18, 0x18, 0x1b, 0x00, 0x01, 0x1f, 0x1b
+    defb 0x00, 0x01, 0x03, 0x03, 0x00, 0x03, 0x0f, 0x06, 0x01, 0xa2, 0x04, 0xbb, 0x00, 0x0f, 0x00, 0x01
+    defb 0x03, 0x00, 0xff, 0x04, 0x00, 0xfa, 0x00, 0x30, 0x18, 0x1b, 0x1b, 0x04, 0x03, 0x0f, 0xe9, 0x05
+    defb 0x00, 0x01, 0x39, 0x01, 0x0f, 0x00, 0x04, 0xb3, 0x0a, 0xd8, 0x00, 0x04, 0x1a, 0x00, 0x01, 0xfa
+    defb 0x00, 0x00, 0x06, 0x00, 0x01, 0x02, 0x06, 0x02, 0x0d, 0x06, 0x08, 0x28, 0x00, 0x04, 0x3b, 0x01
+    defb 0x0f, 0x01, 0x01, 0xa6, 0x02, 0xbd, 0x00, 0x0d, 0x00, 0x01, 0x02, 0xd4, 0x01, 0x04, 0xfb, 0x00
+    defb 0x03, 0x01, 0x00, 0x04, 0x2c, 0x04, 0x09, 0x28, 0x00, 0x0f, 0xfe, 0x03, 0xae, 0x00, 0x01, 0x00
+    defb 0x0b, 0x00, 0x01, 0x04, 0xd4, 0x05, 0x05, 0xf8, 0x00, 0x05, 0x05, 0x00, 0x0c, 0x38, 0x00, 0x0c
+    defb 0x39, 0x01, 0x0f, 0x01, 0x00, 0xa3, 0x0f, 0xc7, 0x00, 0x02, 0x08, 0xf5, 0x00, 0x02, 0x11, 0x01
+    defb 0x0e, 0xee, 0x01, 0x0f, 0x00, 0x01, 0xc7, 0x04, 0xd9, 0x07, 0x05, 0xf8, 0x06, 0x03, 0x09, 0x0a
+    defb 0x0e, 0x39, 0x00, 0x0f, 0x69, 0x00, 0x19, 0x0f, 0x01, 0x00, 0x85, 0x0f, 0x00, 0x01, 0x03, 0x04
+    defb 0xfa, 0x00, 0x06, 0x1b, 0x00, 0x0f, 0xff, 0x09, 0x01, 0x0f, 0x01, 0x00, 0xb2, 0x0f, 0x01, 0x0a
+    defb 0x06, 0x0b, 0xf5, 0x00, 0x0e, 0x26, 0x01, 0x0f, 0x58, 0x00, 0x0b, 0x0f, 0x01, 0x00, 0x95, 0x0e
+    defb 0xda, 0x02, 0x0f, 0x37, 0x00, 0x23, 0x0f, 0x01, 0x00, 0xa5, 0x0f, 0xc9, 0x00, 0x11, 0x02, 0x22
+    defb 0x00, 0x0a, 0x29, 0x06, 0x0f, 0x00, 0x01, 0xc3, 0x03, 0xe4, 0x00, 0x0b, 0x13, 0x09, 0x04, 0x0b
+    defb 0x06, 0x0f, 0x37, 0x00, 0x06, 0x0f, 0x01, 0x00, 0xa8, 0x0f, 0x00, 0x01, 0x00, 0x09, 0xef, 0x06
+    defb 0x03, 0xfc, 0x08, 0x02, 0x0b, 0x00, 0x0f, 0x37, 0x00, 0x05, 0x0f, 0x01, 0x00, 0xa8, 0x0b, 0x00
+    defb 0x01, 0x01, 0x05, 0x00, 0x05, 0xd8, 0x0e, 0x04, 0xfb, 0x00, 0x0f, 0x24, 0x08, 0x00, 0x0f, 0x00
+    defb 0x04, 0xc8, 0x05, 0xf3, 0x00, 0x06, 0xe0, 0x0b, 0x0f, 0x00, 0x01, 0x02, 0x0f, 0x00, 0x09, 0xb1
+    defb 0x0f, 0x00, 0x01, 0x02, 0x07, 0x06, 0x00, 0x0f, 0xfb, 0x0d, 0x00, 0x0f, 0x39, 0x00, 0x07, 0x0f
+    defb 0x01, 0x00, 0x9f, 0x0f, 0xc7, 0x00, 0x03, 0x0f, 0xee, 0x03, 0x10, 0x0f, 0x00, 0x01, 0xc8, 0x0f
+    defb 0x12, 0x03, 0x05, 0x0f, 0x39, 0x00, 0x0e, 0x0f, 0x01, 0x00, 0xa0, 0x0f, 0x00, 0x03, 0x03, 0x07
+    defb 0xfd, 0x05, 0x0c, 0x12, 0x00, 0x0f, 0x39, 0x00, 0x0a, 0x0f, 0x01, 0x00, 0x9f, 0x0f, 0x00, 0x01
+    defb 0x0b, 0x0a, 0x05, 0x07, 0x0f, 0x39, 0x00, 0x0f, 0x0f, 0x01, 0x00, 0x9f, 0x0f, 0x00, 0x03, 0x0c
+    defb 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0x11, 0x18, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0f
+    defb 0x01, 0x00, 0xa7, 0x01, 0xc0, 0x00, 0x01, 0xc7, 0x00, 0x0f, 0x3c, 0x00, 0x21, 0x0f, 0x00, 0x01
+    defb 0xff, 0xd4, 0x2f, 0x18, 0x18, 0x1f, 0x00, 0x03, 0x0f, 0x00, 0x01, 0xce, 0x03, 0xf9, 0x00, 0x1f
+    defb 0x18, 0x01, 0x01, 0x04, 0x05, 0x00, 0x01, 0x0f, 0x02, 0x01, 0xa6, 0x05, 0xc0, 0x00, 0x0f, 0xe0
+    defb 0x00, 0x03, 0x01, 0xf8, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x01, 0x0a, 0x03, 0x45, 0x01, 0x0f
+    defb 0x01, 0x00, 0x9e, 0x04, 0xb6, 0x00, 0x0f, 0x00, 0x01, 0x0a, 0x22, 0x18, 0x18, 0x07, 0x01, 0x0f
+    defb 0x21, 0x00, 0x01, 0x07, 0x00, 0x01, 0x0f, 0x02, 0x02, 0xa2, 0x07, 0xbe, 0x00, 0x0f, 0xdf, 0x00
+    defb 0x04, 0x07, 0xf9, 0x01, 0x0f, 0x22, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x0f, 0x03, 0x01, 0x9c, 0x06
+    defb 0xb9, 0x03, 0x0f, 0x00, 0x01, 0x04, 0x0f, 0xd0, 0x00, 0x0f, 0x09, 0x00, 0x01, 0x0f, 0x02, 0x01
+    defb 0x9b, 0x08, 0xf7, 0x03, 0x0f, 0x00, 0x06, 0x0c, 0x0f, 0xd9, 0x00, 0x07, 0x0f, 0x00, 0x01, 0xcf
+    defb 0x03, 0xd5, 0x00, 0x0f, 0x00, 0x07, 0x0b, 0x04, 0x09, 0x00, 0x0f, 0x02, 0x01, 0x97, 0x05, 0xfe
+    defb 0x00, 0x0f, 0x00, 0x01, 0x0c, 0x04, 0xf8, 0x00, 0x0f, 0x00, 0x02, 0x13, 0x0f, 0x00, 0x01, 0xbf
+    defb 0x03, 0x17, 0x00, 0x0f, 0x00, 0x09, 0x0c, 0x06, 0x4d, 0x00, 0x0f, 0x02, 0x01, 0x93, 0x07, 0xfe
+    defb 0x00, 0x0f, 0x00, 0x02, 0x0e, 0x04, 0x00, 0x09, 0x0f, 0x49, 0x00, 0x04, 0x0f, 0x00, 0x01, 0xd1
+    defb 0x0f, 0xff, 0x08, 0x06, 0x0f, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x03, 0x92, 0x0b, 0xaf, 0x00, 0x0f
+    defb 0x00, 0x01, 0x0a, 0x0f, 0xfd, 0x08, 0x06, 0x0f, 0x00, 0x01, 0x07, 0x0f, 0x04, 0x01, 0x8a, 0x02
+    defb 0xa1, 0x00, 0x0f, 0x00, 0x01, 0x14, 0x00, 0x19, 0x00, 0x02, 0xd4, 0x02, 0x0f, 0x22, 0x00, 0x02
+    defb 0x0e, 0x00, 0x01, 0x0f, 0x29, 0x02, 0x04, 0x0f, 0x01, 0x00, 0x7c, 0x02, 0xd3, 0x01, 0x0f, 0x00
+    defb 0x01, 0x0d, 0x09, 0xcf, 0x03, 0x02, 0x09, 0x01, 0x0f, 0x22, 0x00, 0x00, 0x0f, 0x00, 0x04, 0xc6
+    defb 0x06, 0xf7, 0x02, 0x02, 0x06, 0x04, 0x0f, 0x23, 0x00, 0x01, 0x0f, 0x00, 0x01, 0xca, 0x01, 0x28
+    defb 0x00, 0x0f, 0x01, 0x05, 0x0a, 0x0d, 0x00, 0x01, 0x0f, 0x00, 0x08, 0xbc, 0x04, 0xf9, 0x00, 0x0f
+    defb 0x00, 0x06, 0x16, 0x0f, 0x00, 0x09, 0xbd, 0x06, 0xff, 0x00, 0x0f, 0x00, 0x05, 0x13, 0x0f, 0x00
+    defb 0x01, 0xba, 0x01, 0x17, 0x00, 0x06, 0x01, 0x12, 0x0f, 0x00, 0x05, 0x0f, 0x0f, 0x01, 0x01, 0x96
+    defb 0x06, 0xd3, 0x06, 0x0f, 0x00, 0x05, 0x0a, 0x07, 0xf4, 0x00, 0x0f, 0x01, 0x01, 0x03, 0x0f, 0x00
+    defb 0x01, 0x00, 0x0f, 0x01, 0x00, 0x95, 0x0f, 0x00, 0x01, 0x0e, 0x0b, 0xf2, 0x00, 0x0f, 0x01, 0x01
+    defb 0x02, 0x0f, 0x00, 0x01, 0xc8, 0x0d, 0xf0, 0x00, 0x0f, 0x00, 0x02, 0xe1, 0x07, 0x2d, 0x00, 0x0f
+    defb 0xdd, 0x00, 0x02, 0x0a, 0x42, 0x00, 0x0f, 0x45, 0x05, 0x05, 0x0f, 0x01, 0x00, 0x82, 0x03, 0xb0
+    defb 0x00, 0x0f, 0x00, 0x05, 0x0b, 0x03, 0x05, 0x00, 0x0f, 0xd5, 0x0a, 0x06, 0x0f, 0x00, 0x01, 0xcb
+    defb 0x02, 0x28, 0x00, 0x01, 0x00, 0x09, 0x0f, 0x45, 0x00, 0x07, 0x0f, 0x00, 0x03, 0xc6, 0x04, 0x28
+    defb 0x00, 0x0f, 0xd7, 0x00, 0x09, 0x09, 0x42, 0x00, 0x0f, 0x01, 0x01, 0x9a, 0x09, 0xd5, 0x0d, 0x0f
+    defb 0x00, 0x01, 0x09, 0x0f, 0x1b, 0x00, 0x09, 0x0f, 0x00, 0x01, 0xd2, 0x06, 0xfe, 0x02, 0x0f, 0x00
+    defb 0x09, 0x0c, 0x0f, 0x00, 0x01, 0xbd, 0x05, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x18, 0x00, 0x01
+    defb 0x00, 0x05, 0x11, 0x18, 0x02, 0x00, 0x03, 0x09, 0x00, 0x03, 0x03, 0x00, 0x0f, 0x01, 0x00, 0x93
+    defb 0x04, 0xaf, 0x00, 0x05, 0xbe, 0x00, 0x0f, 0xe5, 0x00, 0x09, 0x0f, 0xd8, 0x00, 0x06, 0x0f, 0x00
+    defb 0x01, 0xcf, 0x03, 0x17, 0x00, 0x04, 0x20, 0x00, 0x0b, 0x26, 0x00, 0x0f, 0x00, 0x01, 0xc7, 0x04
+    defb 0xef, 0x00, 0x0a, 0x17, 0x00, 0x0f, 0x10, 0x00, 0x01, 0x0f, 0x00, 0x01, 0xc2, 0x09, 0x10, 0x00
+    defb 0x1f, 0x18, 0xd6, 0x00, 0x06, 0x07, 0x00, 0x01, 0x0f, 0x01, 0x01, 0x9b, 0x0a, 0xb0, 0x00, 0x0f
+    defb 0x00, 0x04, 0x0a, 0x07, 0xfe, 0x00, 0x0d, 0x24, 0x00, 0x0e, 0x00, 0x01, 0x0f, 0x01, 0x01, 0x93
+    defb 0x03, 0xa9, 0x00, 0x0f, 0x00, 0x01, 0x0a, 0x0f, 0xc9, 0x00, 0x00, 0x0f, 0x00, 0x01, 0xed, 0x0f
+    defb 0x48, 0x00, 0x00, 0x04, 0xf9, 0x03, 0x04, 0x0e, 0x00, 0x0f, 0x01, 0x01, 0x92, 0x02, 0xa7, 0x00
+    defb 0x05, 0xb6, 0x00, 0x0f, 0x00, 0x07, 0x0c, 0x0a, 0x38, 0x00, 0x0b, 0x11, 0x00, 0x08, 0xf9, 0x04
+    defb 0x0f, 0x00, 0x01, 0xa0, 0x06, 0x07, 0x05, 0x0f, 0x00, 0x02, 0x2c, 0x0f, 0x00, 0x01, 0xbf, 0x0b
+    defb 0x30, 0x00, 0x0f, 0x16, 0x00, 0x02, 0x0c, 0x1a, 0x06, 0x0f, 0xff, 0x06, 0x96, 0x0d, 0xab, 0x00
+    defb 0x00, 0xca, 0x00, 0x0f, 0xe7, 0x00, 0x05, 0x0f, 0x1b, 0x09, 0x05, 0x08, 0xfa, 0x03, 0x08, 0x54
+    defb 0x04, 0x0f, 0x01, 0x00, 0x8f, 0x07, 0xac, 0x05, 0x07, 0x06, 0x04, 0x0f, 0xe8, 0x00, 0x05, 0x0f
+    defb 0xd5, 0x00, 0x04, 0x0f, 0x00, 0x01, 0x01, 0x0f, 0x48, 0x04, 0x13, 0x0f, 0x01, 0x00, 0x6e, 0x12
+    defb 0x18, 0xed, 0x00, 0x0f, 0x00, 0x01, 0x11, 0x0f, 0xd3, 0x03, 0x07, 0x0f, 0x30, 0x00, 0x00, 0x0f
+    defb 0x46, 0x02, 0x07, 0x0f, 0x01, 0x00, 0x7a, 0x0f, 0xed, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x04, 0x03
+    defb 0x2c, 0x01, 0x0f, 0x47, 0x00, 0x03, 0x0f, 0x13, 0x00, 0x10, 0x0f, 0x01, 0x00, 0x83, 0x0f, 0xbc
+    defb 0x00, 0x17, 0x15, 0x18, 0x01, 0x00, 0x0d, 0x2e, 0x00, 0x01, 0x48, 0x01, 0x02, 0x17, 0x00, 0x08
+    defb 0x06, 0x00, 0x0f, 0x01, 0x00, 0x92, 0x09, 0xb7, 0x00, 0x04, 0xb8, 0x02, 0x0b, 0xe3, 0x00, 0x0d
+    defb 0x01, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x06, 0x4e, 0x09, 0x0f, 0x01, 0x00, 0x8c
+    defb 0x04, 0xa6, 0x00, 0x0a, 0xad, 0x03, 0x0d, 0xdd, 0x00, 0x0a, 0x01, 0x00, 0x3e, 0x1b, 0x1b, 0x1b
+    defb 0x08, 0x03, 0x07, 0x3d, 0x04, 0x0f, 0x00, 0x01, 0xa6, 0x07, 0xc3, 0x05, 0x0a, 0x26, 0x00, 0x02
+    defb 0xf3, 0x00, 0x05, 0xfe, 0x00, 0x0f, 0x00, 0x01, 0x05, 0x05, 0x3d, 0x02, 0x0f, 0x01, 0x00, 0xa2
+    defb 0x05, 0xc3, 0x03, 0x0f, 0x00, 0x01, 0x03, 0x01, 0x02, 0x01, 0x15, 0x1b, 0x0b, 0x01, 0x0f, 0x42
+    defb 0x00, 0x02, 0x03, 0x18, 0x00, 0x0f, 0x00, 0x0d, 0xa3, 0x06, 0xc0, 0x00, 0x0d, 0x24, 0x00, 0x04
+    defb 0xf5, 0x02, 0x00, 0x05, 0x00, 0x01, 0xff, 0x00, 0x04, 0x09, 0x06, 0x01, 0xf1, 0x01, 0x05, 0x34
+    defb 0x00, 0x04, 0x3f, 0x01, 0x03, 0x15, 0x00, 0x0f, 0x2d, 0x10, 0x07, 0x0f, 0x01, 0x00, 0x77, 0x04
+    defb 0xa8, 0x00, 0x03, 0x04, 0x0b, 0x08, 0xcc, 0x00, 0x05, 0xc1, 0x00, 0x01, 0xef, 0x00, 0x00, 0xf8
+    defb 0x00, 0x01, 0x03, 0x00, 0x02, 0x00, 0x01, 0x04, 0x2b, 0x00, 0x02, 0x0a, 0x00, 0x03, 0x3c, 0x00
+    defb 0x0f, 0x3f, 0x01, 0x04, 0x0f, 0x01, 0x00, 0x97, 0x05, 0xc4, 0x00, 0x02, 0x07, 0x00, 0x04, 0x15
+    defb 0x02, 0x01, 0x05, 0x00, 0x02, 0xfa, 0x00, 0x04, 0x09, 0x03, 0x06, 0xf6, 0x00, 0x01, 0x16, 0x08
+    defb 0x0f, 0x17, 0x06, 0x05, 0x0f, 0x01, 0x00, 0x9c, 0x08, 0xc9, 0x00, 0x04, 0x19, 0x0a, 0x03, 0xed
+    defb 0x00, 0x03, 0xf9, 0x00, 0x07, 0x09, 0x05, 0x0e, 0x01, 0x00, 0x03, 0x31, 0x02, 0x01, 0x30, 0x00
+    defb 0x0f, 0x8d, 0x00, 0x2f, 0x0f, 0x01, 0x00, 0x57, 0x02, 0xef, 0x00, 0x05, 0xea, 0x02, 0x0f, 0x01
+    defb 0x00, 0x04, 0x03, 0xfd, 0x03, 0x03, 0x02, 0x04, 0x05, 0x04, 0x02, 0x04, 0x3e, 0x0e, 0x05, 0x00
+    defb 0x02, 0x05, 0x09, 0x00, 0x0f, 0x01, 0x00, 0x96, 0x0c, 0xbb, 0x00, 0x04, 0xc6, 0x04, 0x05, 0xe5
+    defb 0x00, 0x02, 0xfe, 0x03, 0x02, 0x03, 0x03, 0x01, 0x07, 0x00, 0x06, 0x28, 0x00, 0x04, 0xfa, 0x00
+    defb 0x08, 0x2d, 0x00, 0x0f, 0x00, 0x01, 0xa3, 0x0b, 0xc6, 0x00, 0x09, 0xde, 0x00, 0x05, 0xf9, 0x00
+    defb 0x03, 0x05, 0x03, 0x09, 0xe3, 0x00, 0x03, 0x0d, 0x00, 0x03, 0x28, 0x04, 0x03, 0x0d, 0x00, 0x0f
+    defb 0x91, 0x00, 0x2a, 0x0f, 0x01, 0x00, 0x5c, 0x09, 0xb9, 0x00, 0x04, 0x0d, 0x00, 0x05, 0x1d, 0x00
+    defb 0x03, 0xff, 0x01, 0x03, 0xfe, 0x00, 0x04, 0x01, 0x05, 0x07, 0x23, 0x00, 0x05, 0x3a, 0x00, 0x07
+    defb 0x02, 0x01, 0x0f, 0x00, 0x02, 0xa2, 0x09, 0xc4, 0x00, 0x0a, 0x1c, 0x00, 0x07, 0xfd, 0x00, 0x00
+    defb 0x00, 0x01, 0x07, 0xec, 0x08, 0x09, 0x3c, 0x00, 0x06, 0x49, 0x02, 0x0f, 0x01, 0x00, 0x9a, 0x0b
+    defb 0xbb, 0x00, 0x08, 0xc5, 0x00, 0x03, 0x12, 0x00, 0x06, 0xfb, 0x00, 0x01, 0x06, 0x00, 0x0a, 0x00
+    defb 0x01, 0x06, 0x31, 0x00, 0x06, 0x43, 0x00, 0x0f, 0x94, 0x00, 0x2e, 0x0f, 0x01, 0x00, 0x58, 0x07
+    defb 0x00, 0x03, 0x09, 0xca, 0x00, 0x01, 0x1c, 0x00, 0x01, 0x08, 0x00, 0x06, 0xfb, 0x00, 0x06, 0x02
+    defb 0x08, 0x02, 0x3b, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x0f, 0x93, 0x00, 0x2c, 0x0f, 0x01, 0x00, 0x5a
+    defb 0x0f, 0xc5, 0x00, 0x0c, 0x05, 0xfe, 0x07, 0x04, 0xf9, 0x03, 0x0f, 0xff, 0x00, 0x09, 0x04, 0x1f
+    defb 0x05, 0x0f, 0x91, 0x00, 0x2a, 0x0f, 0x01, 0x00, 0x5c, 0x04, 0xe1, 0x04, 0x0f, 0x01, 0x01, 0x09
+    defb 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x01, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x0e
+    defb 0x00, 0x05, 0x01, 0x00, 0x12, 0x1b, 0x01, 0x00, 0x02, 0x20, 0x00, 0x0f, 0x01, 0x00, 0x95, 0x07
+    defb 0xb7, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x20, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x04, 0x19, 0x00, 0x07
+    defb 0x22, 0x00, 0x01, 0x46, 0x00, 0x0f, 0x00, 0x01, 0xa1, 0x02, 0xba, 0x00, 0x06, 0xf6, 0x00, 0x0b
+    defb 0xe3, 0x00, 0x0e, 0xf5, 0x00, 0x06, 0x26, 0x00, 0x05, 0x22, 0x01, 0x03, 0x4a, 0x00, 0x04, 0x15
+    defb 0x00, 0x0f, 0x01, 0x00, 0x96, 0x04, 0xbb, 0x01, 0x06, 0xf8, 0x00, 0x04, 0x15, 0x00, 0x08, 0xfc
+    defb 0x01, 0x0c, 0x12, 0x00, 0x05, 0x3a, 0x00, 0x06, 0x22, 0x02, 0x07, 0x2c, 0x02, 0x0f, 0x96, 0x00
+    defb 0x2f, 0x0f, 0x01, 0x00, 0x57, 0x07, 0xb4, 0x00, 0x0b, 0x0a, 0x00, 0x0a, 0x1e, 0x00, 0x0b, 0x12
+    defb 0x00, 0x02, 0x0a, 0x00, 0x14, 0x00, 0x2d, 0x00, 0x16, 0x00, 0x37, 0x00, 0x0f, 0x00, 0x03, 0x9f
+    defb 0x06, 0xd1, 0x00, 0x04, 0xe6, 0x00, 0x01, 0x09, 0x00, 0x09, 0xed, 0x00, 0x03, 0x11, 0x00, 0x09
+    defb 0xef, 0x02, 0x05, 0x1a, 0x00, 0x03, 0x05, 0x00, 0x03, 0xff, 0x00, 0x2f, 0x1b, 0x1b, 0x92, 0x00
+    defb 0x2b, 0x0f, 0x01, 0x00, 0x5b, 0x00, 0xfe, 0x03, 0x05, 0xd2, 0x00, 0x04, 0xce, 0x00, 0x0a, 0xef
+    defb 0x02, 0x02, 0x29, 0x00, 0x09, 0x00, 0x01, 0x08, 0x24, 0x02, 0x06, 0x16, 0x00, 0x02, 0x49, 0x03
+    defb 0x0f, 0x00, 0x01, 0x9f, 0x05, 0xfc, 0x04, 0x05, 0x16, 0x00, 0x0f, 0xe5, 0x00, 0x00, 0x0a, 0x1e
+    defb 0x00, 0x05, 0xfe, 0x02, 0x06, 0x14, 0x00, 0x01, 0x18, 0x00, 0x01, 0x4b, 0x06, 0x0f, 0x80, 0x00
+    defb 0x19, 0x0f, 0x01, 0x00, 0x6d, 0x04, 0xfc, 0x06, 0x09, 0xe1, 0x00, 0x04, 0x02, 0x03, 0x0a, 0x13
+    defb 0x01, 0x04, 0x08, 0x00, 0x07, 0x33, 0x03, 0x0b, 0x17, 0x02, 0x0f, 0xfc, 0x04, 0x9c, 0x04, 0x01
+    defb 0x00, 0x0a, 0xbc, 0x00, 0x05, 0xd9, 0x00, 0x04, 0xe9, 0x00, 0x0b, 0x17, 0x00, 0x00, 0x2f, 0x01
+    defb 0x03, 0x18, 0x00, 0x08, 0x36, 0x00, 0x0c, 0x12, 0x03, 0x0f, 0x01, 0x00, 0x98, 0x04, 0xee, 0x03
+    defb 0x0a, 0x0e, 0x00, 0x02, 0xff, 0x00, 0x05, 0xd0, 0x08, 0x09, 0x00, 0x01, 0x02, 0xe6, 0x05, 0x09
+    defb 0x36, 0x01, 0x0f, 0x00, 0x01, 0xbb, 0x02, 0xd0, 0x08, 0x05, 0x1a, 0x08, 0x06, 0x01, 0x06, 0x04
+    defb 0xe6, 0x08, 0x08, 0x30, 0x09, 0x07, 0x37, 0x00, 0x0f, 0x00, 0x03, 0xa9, 0x0a, 0x0e, 0x00, 0x03
+    defb 0xe3, 0x00, 0x04, 0x00, 0x01, 0x04, 0x21, 0x00, 0x02, 0x15, 0x02, 0x08, 0x01, 0x01, 0x0a, 0x48
+    defb 0x00, 0x0f, 0x82, 0x00, 0x23, 0x0f, 0x01, 0x00, 0x6b, 0x0e, 0xc6, 0x00, 0x04, 0xff, 0x00, 0x02
+    defb 0xec, 0x00, 0x08, 0x24, 0x00, 0x03, 0xe7, 0x0b, 0x06, 0xed, 0x0a, 0x0f, 0x00, 0x01, 0xc5, 0x03
+    defb 0xe5, 0x00, 0x06, 0x00, 0x02, 0x03, 0x21, 0x03, 0x03, 0xe4, 0x06, 0x0a, 0x00, 0x01, 0x07, 0x0a
+    defb 0x0a, 0x0f, 0x01, 0x00, 0xa0, 0x03, 0xb8, 0x00, 0x03, 0xd1, 0x07, 0x06, 0x00, 0x01, 0x07, 0xcf
+    defb 0x0e, 0x06, 0xe4, 0x09, 0x02, 0xfb, 0x00, 0x08, 0x2f, 0x0e, 0x02, 0x44, 0x00, 0x0f, 0x00, 0x05
+    defb 0xb5, 0x07, 0xd9, 0x00, 0x02, 0xea, 0x00, 0x03, 0xeb, 0x05, 0x00, 0x2a, 0x09, 0x0c, 0x2c, 0x0f
+    defb 0x02, 0x0b, 0x07, 0x09, 0x37, 0x00, 0x0f, 0x00, 0x09, 0xa1, 0x0a, 0xc9, 0x01, 0x03, 0xf5, 0x06
+    defb 0x06, 0xcf, 0x00, 0x01, 0x22, 0x00, 0x03, 0x09, 0x00, 0x07, 0xff, 0x00, 0x04, 0x07, 0x08, 0x06
+    defb 0x0d, 0x09, 0x04, 0x32, 0x00, 0x0f, 0x94, 0x00, 0x2d, 0x0f, 0x01, 0x00, 0x59, 0x04, 0xcf, 0x00
+    defb 0x00, 0x0c, 0x00, 0x04, 0xd7, 0x00, 0x06, 0xdc, 0x00, 0x0a, 0xf8, 0x00, 0x0a, 0x01, 0x01, 0x02
+    defb 0xfd, 0x01, 0x03, 0x0e, 0x00, 0x01, 0x4c, 0x00, 0x02, 0x13, 0x00, 0x0f, 0x00, 0x01, 0xa0, 0x17
+    defb 0x1b, 0xc5, 0x02, 0x01, 0xdc, 0x04, 0x05, 0x03, 0x02, 0x0d, 0xf6, 0x01, 0x05, 0xfd, 0x03, 0x04
+    defb 0x20, 0x04, 0x07, 0x40, 0x01, 0x03, 0xff, 0x00, 0x0f, 0x04, 0x04, 0x9a, 0x02, 0xc1, 0x01, 0x02
+    defb 0xb4, 0x01, 0x09, 0xf2, 0x02, 0x04, 0xe7, 0x08, 0x0f, 0x1a, 0x13, 0x00, 0x04, 0xf9, 0x01, 0x03
+    defb 0x2b, 0x01, 0x04, 0x37, 0x0f, 0x06, 0x1a, 0x0b, 0x0f, 0x02, 0x01, 0x96, 0x05, 0xcf, 0x00, 0x00
+    defb 0xb5, 0x01, 0x01, 0xb9, 0x00, 0x03, 0xf4, 0x00, 0x04, 0xdc, 0x00, 0x0f, 0x17, 0x14, 0x01, 0x02
+    defb 0xf5, 0x02, 0x0c, 0x18, 0x02, 0x02, 0xfb, 0x01, 0x0f, 0x01, 0x01, 0x9b, 0x04, 0xff, 0x00, 0x04
+    defb 0xc6, 0x03, 0x0a, 0xf3, 0x02, 0x04, 0x0b, 0x03, 0x0e, 0xff, 0x00, 0x04, 0xee, 0x00, 0x0a, 0x3a
+    defb 0x14, 0x03, 0xff, 0x00, 0x0f, 0x01, 0x01, 0x97, 0x07, 0xcf, 0x00, 0x0a, 0xf2, 0x05, 0x06, 0xd8
+    defb 0x04, 0x0e, 0x01, 0x01, 0x05, 0x12, 0x00, 0x06, 0xee, 0x02, 0x09, 0x2a, 0x15, 0x0e, 0x17, 0x0a
+    defb 0x0f, 0x01, 0x00, 0x85, 0x0b, 0xb1, 0x00, 0x07, 0xc9, 0x00, 0x07, 0x03, 0x07, 0x06, 0x01, 0x01
+    defb 0x07, 0x33, 0x00, 0x02, 0x27, 0x03, 0x05, 0x08, 0x0f, 0x07, 0x2d, 0x10, 0x05, 0x3a, 0x0d, 0x0f
+    defb 0x08, 0x12, 0x8d, 0x02, 0xe5, 0x01, 0x07, 0xb3, 0x00, 0x04, 0xd3, 0x11, 0x08, 0x00, 0x01, 0x0c
+    defb 0xd6, 0x10, 0x09, 0x27, 0x01, 0x03, 0x39, 0x06, 0x00, 0x44, 0x00, 0x04, 0x14, 0x00, 0x06, 0x00
+    defb 0x01, 0x0f, 0x08, 0x13, 0x8e, 0x03, 0xdf, 0x03, 0x0b, 0x00, 0x01, 0x00, 0x05, 0x00, 0x02, 0xf3
+    defb 0x05, 0x03, 0xd7, 0x07, 0x0a, 0x01, 0x01, 0x06, 0x0e, 0x00, 0x05, 0x00, 0x01, 0x05, 0x20, 0x02
+    defb 0x01, 0x3f, 0x15, 0x02, 0x44, 0x00, 0x04, 0x42, 0x00, 0x0f, 0xa4, 0x00, 0x2d, 0x0f, 0x01, 0x00
+    defb 0x49, 0x04, 0xbe, 0x01, 0x03, 0xf6, 0x00, 0x04, 0xfd, 0x15, 0x05, 0xd3, 0x08, 0x05, 0x15, 0x13
+    defb 0x0d, 0x00, 0x01, 0x04, 0xeb, 0x0b, 0x04, 0x00, 0x09, 0x04, 0x20, 0x00, 0x07, 0x07, 0x01, 0x02
+    defb 0x41, 0x02, 0x0f, 0x00, 0x01, 0x8c, 0x03, 0xdc, 0x0e, 0x05, 0xf9, 0x00, 0x06, 0x01, 0x08, 0x06
+    defb 0x00, 0x04, 0x03, 0x09, 0x14, 0x06, 0xe5, 0x11, 0x02, 0x28, 0x0d, 0x05, 0x00, 0x01, 0x05, 0x20
+    defb 0x04, 0x0b, 0x38, 0x0c, 0x0f, 0x08, 0x0b, 0x8f, 0x05, 0xe0, 0x05, 0x06, 0x01, 0x00, 0x04, 0xf4
+    defb 0x12, 0x05, 0xf8, 0x10, 0x04, 0x15, 0x0d, 0x07, 0xf7, 0x00, 0x00, 0x3b, 0x00, 0x09, 0x00, 0x01
+    defb 0x06, 0xf1, 0x07, 0x07, 0x00, 0x01, 0x03, 0x3d, 0x07, 0x0f, 0xa6, 0x00, 0x2f, 0x0f, 0x01, 0x00
+    defb 0x47, 0x04, 0xc3, 0x08, 0x0c, 0xff, 0x00, 0x08, 0xde, 0x06, 0x07, 0xf4, 0x0f, 0x04, 0x04, 0x00
+    defb 0x06, 0x24, 0x05, 0x05, 0x22, 0x0b, 0x05, 0x3b, 0x05, 0x03, 0x1e, 0x00, 0x0f, 0x00, 0x01, 0x9e
+    defb 0x07, 0xba, 0x00, 0x02, 0xff, 0x09, 0x07, 0xde, 0x00, 0x06, 0x00, 0x03, 0x07, 0x28, 0x00, 0x09
+    defb 0xed, 0x02, 0x05, 0x39, 0x03, 0x06, 0x48, 0x0f, 0x03, 0x38, 0x0f, 0x0f, 0x00, 0x01, 0x90, 0x01
+    defb 0xbe, 0x0f, 0x07, 0xfe, 0x01, 0x0a, 0x00, 0x10, 0x07, 0x00, 0x04, 0x30, 0x18, 0x00, 0x18, 0x00
+    defb 0x00, 0x91, 0x18, 0x18, 0x18, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x00
+    defb 0x11, 0x18, 0x07, 0x00, 0x04, 0x0d, 0x00, 0x20, 0x18, 0x00, 0x20, 0x00, 0x01, 0x23, 0x00, 0x06
+    defb 0x27, 0x00, 0x0f, 0x01, 0x00, 0x89, 0x04, 0xaa, 0x00, 0x01, 0xb6, 0x00, 0x04, 0xc4, 0x00, 0x03
+    defb 0xd3, 0x00, 0x07, 0xc3, 0x00, 0x03, 0x23, 0x00, 0x05, 0x07, 0x00, 0x07, 0x3d, 0x00, 0x00, 0x07
+    defb 0x00, 0x06, 0xff, 0x00, 0x00, 0x00, 0x01, 0x04, 0x02, 0x01, 0x0f, 0x99, 0x00, 0x2a, 0x0f, 0x01
+    defb 0x00, 0x56, 0x05, 0xfe, 0x00, 0x14, 0x1b, 0xf3, 0x00, 0x02, 0xcf, 0x00, 0x0f, 0x00, 0x01, 0x05
+    defb 0x01, 0x08, 0x00, 0x01, 0x11, 0x00, 0x03, 0x21, 0x00, 0x02, 0x23, 0x00, 0x06, 0x00, 0x01, 0x05
+    defb 0x4d, 0x00, 0x0f, 0x01, 0x00, 0x95, 0x03, 0xb3, 0x01, 0x09, 0x00, 0x01, 0x25, 0x00, 0x00, 0xdf
+    defb 0x00, 0x03, 0x05, 0x00, 0x05, 0xd5, 0x02, 0x06, 0x04, 0x02, 0x03, 0x06, 0x00, 0x06, 0x2d, 0x00
+    defb 0x04, 0x00, 0x02, 0x01, 0x51, 0x00, 0x0f, 0x98, 0x00, 0x2e, 0x0f, 0x01, 0x00, 0x54, 0x02, 0xaf
+    defb 0x01, 0x09, 0x00, 0x02, 0x02, 0xd3, 0x00, 0x04, 0xe0, 0x00, 0x0b, 0xfd, 0x00, 0x06, 0x03, 0x02
+    defb 0x03, 0xfa, 0x02, 0x04, 0x00, 0x01, 0x03, 0x3e, 0x00, 0x01, 0x4c, 0x00, 0x0f, 0x00, 0x01, 0x9b
+    defb 0x03, 0xb2, 0x01, 0x04, 0xeb, 0x01, 0x04, 0x00, 0x01, 0x03, 0xe3, 0x00, 0x08, 0xfc, 0x02, 0x00
+    defb 0xd9, 0x00, 0x05, 0xf7, 0x01, 0x02, 0xe4, 0x00, 0x05, 0x04, 0x02, 0x06, 0xff, 0x00, 0x0f, 0xff
+    defb 0x01, 0x99, 0x02, 0x01, 0x02, 0x06, 0x01, 0x01, 0x05, 0xfc, 0x01, 0x02, 0x1b, 0x00, 0x05, 0x09
+    defb 0x02, 0x01, 0xfd, 0x00, 0x07, 0x00, 0x01, 0x05, 0x26, 0x05, 0x01, 0xfe, 0x01, 0x05, 0x00, 0x01
+    defb 0x03, 0xff, 0x00, 0x0f, 0x00, 0x04, 0xa0, 0x05, 0x02, 0x02, 0x03, 0xd1, 0x00, 0x05, 0xda, 0x06
+    defb 0x09, 0x00, 0x01, 0x07, 0xff, 0x01, 0x03, 0x20, 0x03, 0x02, 0x22, 0x00, 0x04, 0x04, 0x04, 0x01
+    defb 0x23, 0x00, 0x01, 0x20, 0x03, 0x0f, 0x01, 0x00, 0x96, 0x03, 0x01, 0x06, 0x02, 0xdc, 0x00, 0x03
+    defb 0xfa, 0x00, 0x04, 0x19, 0x00, 0x07, 0x0a, 0x04, 0x04, 0x01, 0x01, 0x01, 0xdc, 0x03, 0x07, 0xf9
+    defb 0x07, 0x03, 0x2c, 0x00, 0x02, 0x02, 0x00, 0x03, 0x36, 0x02, 0x0f, 0xff, 0x00, 0x99, 0x06, 0xb0
+    defb 0x00, 0x01, 0xfe, 0x00, 0x04, 0xd1, 0x06, 0x03, 0x19, 0x00, 0x02, 0x05, 0x00, 0x02, 0x24, 0x04
+    defb 0x01, 0xdb, 0x01, 0x03, 0x06, 0x02, 0x06, 0x26, 0x00, 0x04, 0x34, 0x01, 0x05, 0x35, 0x02, 0x0a
+    defb 0x19, 0x01, 0x0f, 0x01, 0x00, 0x90, 0x06, 0xc8, 0x03, 0x06, 0xc7, 0x00, 0x06, 0xc2, 0x00, 0x02
+    defb 0xfe, 0x00, 0x05, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x08, 0x3e, 0x00, 0x04, 0x02, 0x06, 0x04, 0x0a
+    defb 0x08, 0x03, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x98, 0x06, 0xb3, 0x00, 0x04, 0xc7, 0x00, 0x08, 0x06
+    defb 0x02, 0x02, 0xd5, 0x08, 0x04, 0xfb, 0x03, 0x04, 0x0d, 0x06, 0x0c, 0xe4, 0x00, 0x0f, 0xff, 0x00
+    defb 0xa8, 0x0c, 0x01, 0x01, 0x0b, 0x1b, 0x00, 0x07, 0xf5, 0x00, 0x03, 0xe2, 0x05, 0x03, 0x02, 0x01
+    defb 0x0b, 0x27, 0x00, 0x07, 0x01, 0x01, 0x0f, 0x01, 0x00, 0xa0, 0x0a, 0x00, 0x02, 0x07, 0x18, 0x00
+    defb 0x04, 0xf5, 0x02, 0x05, 0x01, 0x01, 0x08, 0x2a, 0x07, 0x07, 0x3f, 0x00, 0x07, 0x00, 0x04, 0x0f
+    defb 0x01, 0x00, 0xa1, 0x09, 0x00, 0x04, 0x07, 0x17, 0x00, 0x0a, 0xf3, 0x00, 0x0c, 0xfa, 0x00, 0x02
+    defb 0x38, 0x05, 0x0f, 0x00, 0x01, 0xbf, 0x05, 0xd8, 0x00, 0x03, 0x1d, 0x00, 0x0a, 0x01, 0x00, 0x1c
+    defb 0x1b, 0x3a, 0x00, 0x0e, 0x00, 0x01, 0x0f, 0x00, 0x08, 0x99, 0x04, 0x06, 0x00, 0x08, 0x00, 0x02
+    defb 0x0a, 0xc0, 0x00, 0x07, 0xff, 0x01, 0x01, 0x1d, 0x00, 0x0d, 0x26, 0x04, 0x07, 0x00, 0x01, 0x08
+    defb 0x55, 0x00, 0x0f, 0x01, 0x00, 0x92, 0x08, 0xb4, 0x00, 0x0e, 0x00, 0x04, 0x06, 0x0d, 0x07, 0x04
+    defb 0x00, 0x01, 0x0d, 0x05, 0x03, 0x0a, 0x00, 0x08, 0x0b, 0x55, 0x00, 0x0f, 0x01, 0x00, 0x8f, 0x0f
+    defb 0x00, 0x01, 0x00, 0x08, 0xdc, 0x00, 0x05, 0xee, 0x00, 0x04, 0xf5, 0x00, 0x05, 0xfa, 0x0f, 0x0a
+    defb 0x45, 0x00, 0x0f, 0x00, 0x02, 0xc4, 0x02, 0xeb, 0x00, 0x05, 0xe4, 0x11, 0x06, 0x22, 0x04, 0x08
+    defb 0x37, 0x03, 0x03, 0x39, 0x00, 0x07, 0x3e, 0x00, 0x0f, 0x00, 0x01, 0x9f, 0x0a, 0xc2, 0x00, 0x06
+    defb 0xc9, 0x04, 0x06, 0xde, 0x05, 0x02, 0x27, 0x0a, 0x0a, 0x0a, 0x04, 0x0d, 0x3e, 0x00, 0x0f, 0x00
+    defb 0x05, 0xaa, 0x0a, 0xc2, 0x01, 0x07, 0xf6, 0x03, 0x07, 0xe9, 0x12, 0x08, 0x00, 0x04, 0x06, 0x09
+    defb 0x05, 0x0f, 0x00, 0x01, 0xc2, 0x04, 0xf5, 0x02, 0x05, 0xff, 0x00, 0x06, 0x01, 0x02, 0x0b, 0x3e
+    defb 0x00, 0x0f, 0x00, 0x07, 0xbe, 0x08, 0xc2, 0x00, 0x05, 0x00, 0x01, 0x07, 0x0f, 0x0f, 0x0c, 0xe1
+    defb 0x00, 0x0f, 0x00, 0x01, 0xbf, 0x06, 0x1f, 0x00, 0x0a, 0xf1, 0x10, 0x05, 0x0f, 0x05, 0x0c, 0x26
+    defb 0x00, 0x0f, 0x40, 0x06, 0x03, 0x0f, 0x01, 0x00, 0x91, 0x09, 0xf9, 0x0e, 0x0e, 0xbd, 0x00, 0x05
+    defb 0xf5, 0x00, 0x04, 0x00, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x07, 0x39, 0x05, 0x0f, 0x00, 0x01, 0xa6
+    defb 0x08, 0xc7, 0x00, 0x08, 0x1e, 0x00, 0x08, 0xef, 0x17, 0x0f, 0xfd, 0x07, 0x02, 0x0c, 0x00, 0x01
+    defb 0x0f, 0x02, 0x01, 0x9b, 0x0a, 0xf7, 0x0a, 0x0f, 0x00, 0x02, 0x02, 0x07, 0xff, 0x00, 0x07, 0x09
+    defb 0x09, 0x0a, 0x45, 0x00, 0x0f, 0x00, 0x01, 0xc6, 0x08, 0xf6, 0x00, 0x03, 0x02, 0x09, 0x0e, 0x01
+    defb 0x01, 0x0f, 0x00, 0x01, 0xc7, 0x09, 0xf5, 0x00, 0x05, 0x09, 0x06, 0x04, 0x13, 0x05, 0x06, 0x45
+    defb 0x00, 0x05, 0x0f, 0x19, 0x0f, 0x02, 0x01, 0x9b, 0x05, 0xfe, 0x00, 0x05, 0xd0, 0x08, 0x0a, 0xd7
+    defb 0x00, 0x05, 0xec, 0x00, 0x08, 0xf7, 0x09, 0x06, 0x13, 0x06, 0x06, 0x29, 0x00, 0x0f, 0x00, 0x01
+    defb 0xc8, 0x02, 0x0b, 0x00, 0x06, 0x08, 0x0c, 0x04, 0x01, 0x01, 0x09, 0x29, 0x00, 0x05, 0x3e, 0x09
+    defb 0x0f, 0x00, 0x01, 0xa6, 0x0a, 0x00, 0x0a, 0x04, 0x20, 0x00, 0x07, 0xf3, 0x00, 0x10, 0x00, 0x00
+    defb 0x00, 0x12, 0x00, 0x01, 0x00, 0x13, 0x18, 0x04, 0x00, 0x09, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x03
+    defb 0x0e, 0x00, 0x01, 0x03, 0x00, 0x07, 0x21, 0x00, 0x0f, 0x01, 0x00, 0x89, 0x01, 0xa9, 0x00, 0x02
+    defb 0x03, 0x00, 0x07, 0xc7, 0x00, 0x0d, 0xde, 0x00, 0x0f, 0x48, 0x00, 0x13, 0x05, 0x32, 0x00, 0x1f
+    defb 0x18, 0x00, 0x01, 0x99, 0x05, 0xfe, 0x00, 0x0a, 0xc7, 0x00, 0x0f, 0x39, 0x00, 0x0e, 0x0b, 0x2b
+    defb 0x00, 0x09, 0x01, 0x02, 0x0f, 0x00, 0x02, 0x9a, 0x09, 0xff, 0x01, 0x0a, 0x1d, 0x00, 0x0a, 0x11
+    defb 0x00, 0x04, 0x0d, 0x00, 0x01, 0x08, 0x00, 0x0a, 0xf2, 0x01, 0x08, 0x49, 0x02, 0x0f, 0x02, 0x01
+    defb 0x97, 0x06, 0xfe, 0x00, 0x08, 0xb7, 0x03, 0x0c, 0x0e, 0x02, 0x05, 0xf7, 0x00, 0x09, 0x00, 0x01
+    defb 0x08, 0x46, 0x00, 0x0b, 0x15, 0x00, 0x01, 0x57, 0x00, 0x05, 0x2e, 0x00, 0x0f, 0x01, 0x00, 0x88
+    defb 0x00, 0xa5, 0x00, 0x09, 0xa9, 0x01, 0x0d, 0xcb, 0x00, 0x08, 0x0f, 0x00, 0x05, 0x2a, 0x03, 0x0f
+    defb 0xda, 0x00, 0x02, 0x09, 0x4a, 0x01, 0x0f, 0x00, 0x01, 0x9d, 0x0f, 0xb6, 0x05, 0x0a, 0x04, 0xf4
+    defb 0x00, 0x32, 0x18, 0x18, 0x1f, 0xd5, 0x00, 0x0f, 0x00, 0x01, 0x12, 0x0f, 0x00, 0x03, 0x97, 0x0f
+    defb 0x00, 0x01, 0x13, 0x00, 0xfd, 0x00, 0x03, 0x00, 0x01, 0x0f, 0x4c, 0x00, 0x06, 0x04, 0x2f, 0x00
+    defb 0x0f, 0x00, 0x06, 0xa4, 0x0f, 0xb6, 0x00, 0x09, 0x00, 0xfd, 0x00, 0x16, 0x1f, 0x03, 0x04, 0x0f
+    defb 0x49, 0x00, 0x01, 0x03, 0x22, 0x04, 0x03, 0x08, 0x00, 0x0f, 0x01, 0x01, 0x92, 0x07, 0xac, 0x00
+    defb 0x02, 0x08, 0x00, 0x0f, 0xe0, 0x00, 0x07, 0x60, 0x18, 0x00, 0x1f, 0x1f, 0x1f, 0x18, 0x01, 0x00
+    defb 0x0f, 0x4a, 0x00, 0x04, 0x0b, 0x00, 0x01, 0x0f, 0x01, 0x00, 0x95, 0x0f, 0x00, 0x01, 0x11, 0x01
+    defb 0xf7, 0x00, 0x11, 0x1f, 0xff, 0x01, 0x04, 0x03, 0x00, 0x0d, 0x24, 0x05, 0x06, 0x44, 0x00, 0x0f
+    defb 0xfe, 0x07, 0x97, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04, 0x05, 0xc6, 0x07, 0x09, 0x1e, 0x00, 0x07
+    defb 0xf3, 0x00, 0x01, 0x05, 0x03, 0x03, 0xfe, 0x00, 0x1f, 0x1f, 0x45, 0x00, 0x00, 0x08, 0x36, 0x00
+    defb 0x0f, 0x7a, 0x00, 0x11, 0x0f, 0x01, 0x00, 0x73, 0x0a, 0xac, 0x00, 0x0d, 0x01, 0x01, 0x00, 0xf3
+    defb 0x02, 0x01, 0xfd, 0x02, 0x02, 0x28, 0x00, 0x00, 0x03, 0x03, 0x01, 0x0f, 0x02, 0x0b, 0x45, 0x00
+    defb 0x0f, 0x00, 0x03, 0xb7, 0x0e, 0x01, 0x02, 0x00, 0xf1, 0x00, 0x14, 0x1f, 0xf1, 0x01, 0x11, 0x1f
+    defb 0x2c, 0x00, 0x0c, 0x09, 0x06, 0x0b, 0x00, 0x01, 0x0f, 0x00, 0x03, 0x9b, 0x0f, 0x00, 0x01, 0x09
+    defb 0x00, 0xf7, 0x05, 0x01, 0xf1, 0x00, 0x02, 0x0d, 0x00, 0x02, 0x00, 0x05, 0x0e, 0xdf, 0x01, 0x0f
+    defb 0x00, 0x01, 0xc6, 0x02, 0x19, 0x00, 0x03, 0xf9, 0x00, 0x20, 0x18, 0x1f, 0x04, 0x05, 0x00, 0x08
+    defb 0x08, 0x0e, 0x45, 0x00, 0x06, 0x00, 0x01, 0x04, 0x55, 0x00, 0x0f, 0x01, 0x00, 0x94, 0x0a, 0xde
+    defb 0x0a, 0x0f, 0x00, 0x01, 0x00, 0x01, 0xf8, 0x08, 0x01, 0xfd, 0x06, 0x01, 0x03, 0x00, 0x01, 0x12
+    defb 0x04, 0x0f, 0x01, 0x02, 0x02, 0x0f, 0xf8, 0x03, 0x9b, 0x0c, 0x01, 0x00, 0x0f, 0x00, 0x06, 0x03
+    defb 0x02, 0xf5, 0x02, 0x10, 0x1f, 0xf8, 0x04, 0x00, 0x02, 0x01, 0x10, 0x00, 0x06, 0x00, 0x1f, 0x1f
+    defb 0xe0, 0x01, 0x00, 0x09, 0x48, 0x0e, 0x0f, 0x01, 0x00, 0xa2, 0x0f, 0xff, 0x02, 0x06, 0x00, 0xf5
+    defb 0x05, 0x03, 0xfb, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0xe5, 0x00, 0x02, 0x09, 0x48, 0x0b, 0x0f
+    defb 0x01, 0x00, 0x9f, 0x0f, 0xb6, 0x0f, 0x0b, 0x02, 0xf5, 0x00, 0x01, 0x04, 0x06, 0x06, 0x09, 0x06
+    defb 0x0c, 0x23, 0x00, 0x0f, 0x00, 0x02, 0xc5, 0x01, 0x01, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x07, 0x02
+    defb 0x02, 0x09, 0x00, 0x0f, 0x3e, 0x00, 0x02, 0x0f, 0xf8, 0x09, 0x9d, 0x0c, 0x01, 0x00, 0x0f, 0xc2
+    defb 0x00, 0x0a, 0x01, 0xf8, 0x04, 0x00, 0x03, 0x00, 0x01, 0xfe, 0x02, 0x0f, 0x24, 0x00, 0x00, 0x0f
+    defb 0x00, 0x01, 0xc9, 0x01, 0x18, 0x00, 0x01, 0xf7, 0x04, 0x05, 0x10, 0x0b, 0x0f, 0x3e, 0x00, 0x05
+    defb 0x0f, 0x01, 0x00, 0xaa, 0x0f, 0x00, 0x01, 0x06, 0x05, 0xf0, 0x0c, 0x0f, 0xff, 0x10, 0x07, 0x0f
+    defb 0xfe, 0x04, 0xaa, 0x00, 0x01, 0x00, 0x0f, 0xba, 0x0d, 0x09, 0x04, 0xfc, 0x00, 0x0f, 0xfe, 0x10
+    defb 0x0d, 0x0f, 0x00, 0x01, 0xc5, 0x03, 0x22, 0x00, 0x0f, 0xdc, 0x00, 0x09, 0x01, 0x3b, 0x05, 0x0f
+    defb 0x00, 0x01, 0xad, 0x0f, 0x00, 0x06, 0x07, 0x0f, 0x3f, 0x00, 0x10, 0x03, 0x02, 0x0a, 0x0f, 0x3f
+    defb 0x00, 0x23, 0x0f, 0x01, 0x00, 0x6f, 0x04, 0xfe, 0x09, 0x0f, 0x00, 0x01, 0x2c, 0x0f, 0x01, 0x00
+    defb 0xaa, 0x0f, 0x00, 0x01, 0xff, 0x30, 0x0f, 0x00, 0x0a, 0xc5, 0x0f, 0x3e, 0x00, 0x10, 0x0f, 0x00
+    defb 0x01, 0xf2, 0x0f, 0x01, 0x00, 0xab, 0x0f, 0xc5, 0x00, 0x0d, 0x00, 0x00, 0x00
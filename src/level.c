@@ -87,6 +87,23 @@ static void load_segment(uint8_t idx) {
     calculate_boundaries();
 }
 
+// Queue enemy spawn objects the player has reached in this segment
+// Objects are sorted by block offset; a full queue drops the event.
+static void check_objects(void) {
+    const LevelObject* obj;
+
+    while (level_state.obj_idx < level_state.obj_segment_end) {
+        obj = &level_state.def->objects[level_state.obj_idx];
+        if (obj->at > level_state.blocks_scrolled) break;
+
+        if (OBJECT_TYPE(obj->data) == OBJ_ENEMY_SPAWN &&
+            level_state.spawn_count < LEVEL_SPAWN_QUEUE) {
+            level_state.spawn_queue[level_state.spawn_count++] = OBJECT_SIZE(obj->data);
+        }
+        level_state.obj_idx++;
+    }
+}
+
 // Check if next segment exists and has different lane config
 static uint8_t check_transition_needed(void) {
     uint8_t next_idx = level_state.segment_idx + 1;
@@ -144,6 +161,7 @@ void level_update(int16_t scroll_y) {
             level_state.scroll_accumulator -= BLOCK_SIZE_PX;
             level_state.block_counter--;
             level_state.blocks_scrolled++;
+            check_objects();
 
             // Check for segment transition
             if (level_state.block_counter == 0) {
@@ -207,6 +225,21 @@ uint8_t level_is_complete(void) {
             level_state.block_counter == 0) ? 1 : 0;
 }
 
+// Take the oldest queued enemy spawn event
+uint8_t level_take_spawn(void) {
+    uint8_t variant;
+    uint8_t i;
+
+    if (level_state.spawn_count == 0) return LEVEL_SPAWN_NONE;
+
+    variant = level_state.spawn_queue[0];
+    level_state.spawn_count--;
+    for (i = 0; i < level_state.spawn_count; i++) {
+        level_state.spawn_queue[i] = level_state.spawn_queue[i + 1];
+    }
+    return variant;
+}
+
 // Tile indices (must match tilemap.c definitions)
 #define TILE_ROAD_LEFT    0x00  // left border
 #define TILE_ROAD_MID_TL  0x01  // highway middle top-left
@@ -28,6 +28,15 @@
 #define SIZE_FULL     2   // Full lane width (needs jump)
 // Reserved: 3-7 for variants
 
+// Enemy spawn variants (size field of OBJ_ENEMY_SPAWN)
+// Same order as FORMATION_* in enemy.h
+#define SPAWN_PATROL  0   // Single patrol
+#define SPAWN_GROUP   1   // Group patrol
+#define SPAWN_ARROW   2   // Arrow formation
+#define SPAWN_DIVE    3   // Galaga dive
+#define SPAWN_LOOP    4   // Dive with a loop
+#define SPAWN_RANDOM  7   // Wave director picks
+
 // Object lane position (2 bits)
 #define OBJ_LANE_LEFT   0
 #define OBJ_LANE_RIGHT  1
@@ -40,6 +49,8 @@
 #define TRANSITION_BLOCKS   4       // Blocks where lanes connect for switching
 #define SCREEN_CENTER_PX    128     // Center of 256px screen
 #define TILEMAP_CENTER_TILE 20      // Center tile (with 4-tile offset)
+#define LEVEL_SPAWN_QUEUE   4       // Enemy spawn events waiting for the director
+#define LEVEL_SPAWN_NONE    0xFF    // level_take_spawn: queue empty
 
 // ============================================================================
 // HELPER MACROS - Packing
@@ -136,6 +147,10 @@ typedef struct {
     int16_t last_scroll_y;       // Last scroll position (for detecting new rows)
     int16_t scroll_accumulator;  // Accumulated scroll pixels (for block counting)
 
+    // Enemy spawn events reached but not yet taken (SPAWN_* variants)
+    uint8_t spawn_queue[LEVEL_SPAWN_QUEUE];
+    uint8_t spawn_count;
+
 } LevelState;
 
 // ============================================================================
@@ -185,6 +200,10 @@ uint8_t level_is_complete(void);
 // tiles: output array of 40 tile indices
 void level_generate_row(uint8_t row, int16_t world_y, uint8_t* tiles);
 
+// Take the oldest queued enemy spawn event (SPAWN_* variant)
+// Returns LEVEL_SPAWN_NONE if no OBJ_ENEMY_SPAWN has been reached
+uint8_t level_take_spawn(void);
+
 // Get current segment info (for debugging/display)
 uint8_t level_get_segment_index(void);
 uint8_t level_get_blocks_remaining(void);
@@ -0,0 +1,94 @@
+; LZ stream decompressor (format from tools/png_to_asm.py --lz)
+;
+; void lz_unpack(const uint8_t *src, uint8_t *dst) __z88dk_callee
+;
+; Stream: token (high nibble literals, low nibble match length - 4,
+; 15 = extended by following bytes while 255), literals, 16-bit
+; offset (0 = end), extended match length.
+; Literal runs and matches are copied with LDIR; overlapping matches
+; (offset < length) replicate bytes as LDIR copies forward.
+; Uses AF, BC, DE, HL only (IX/IY preserved).
+
+SECTION code_user
+
+PUBLIC _lz_unpack
+
+_lz_unpack:
+    pop hl                  ; return address
+    pop bc                  ; src
+    pop de                  ; dst
+    push hl
+    ld h,b
+    ld l,c
+
+lz_loop:
+    ld a,(hl)               ; token
+    inc hl
+    push af
+
+    ; Literal run
+    rrca
+    rrca
+    rrca
+    rrca
+    and 0x0F
+    jr z,lz_offset
+    ld b,0
+    ld c,a
+    cp 15
+    call z,lz_ext
+    ldir
+
+lz_offset:
+    ld c,(hl)               ; offset (0 = end of stream)
+    inc hl
+    ld b,(hl)
+    inc hl
+    ld a,b
+    or c
+    jr z,lz_end
+
+    ; Match length
+    pop af
+    push bc                 ; save offset
+    and 0x0F
+    ld b,0
+    ld c,a
+    cp 15
+    call z,lz_ext
+    inc bc
+    inc bc
+    inc bc
+    inc bc
+
+    ; Match source = dst - offset
+    ex (sp),hl              ; HL = offset, (sp) = src
+    ld a,e
+    sub l
+    ld l,a
+    ld a,d
+    sbc a,h
+    ld h,a
+    ldir
+    pop hl                  ; src
+    jr lz_loop
+
+lz_end:
+    pop af
+    ret
+
+; Add extension bytes to BC while they are 255
+lz_ext:
+    ld a,(hl)
+    inc hl
+    add a,c
+    ld c,a
+    jr nc,lz_ext_nc
+    inc b
+lz_ext_nc:
+    dec hl
+    ld a,(hl)
+    inc hl
+    inc a                   ; 255 -> 0
+    jr z,lz_ext
+    ret
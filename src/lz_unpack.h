@@ -0,0 +1,11 @@
+#ifndef LZ_UNPACK_H
+#define LZ_UNPACK_H
+
+#include <stdint.h>
+
+// Decompress one LZ stream (tools/png_to_asm.py --lz) from src to dst
+// Z80 routine in lz_unpack.asm, copies runs with LDIR
+// src and dst must both be mapped for the whole call
+void lz_unpack(const uint8_t *src, uint8_t *dst) __z88dk_callee;
+
+#endif // LZ_UNPACK_H
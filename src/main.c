@@ -4,10 +4,12 @@
 #include "game.h"
 #include "sprites.h"
 #include "layer2.h"
+#include "copper.h"
 #include "tilemap.h"
 #include "ula.h"
 #include "sound.h"
 #include "debug_hud.h"
+#include "director.h"
 
 // Write to Next register
 static void nextreg(uint8_t reg, uint8_t val) {
@@ -127,6 +129,16 @@ int main(void) {
 
     while (1) {
         wait_vblank();
+        director_frame_start();
+
+        // Upload sprite attributes rendered last frame
+        sprites_flush();
+
+        // Show a finished Layer 2 back buffer (no-op when single buffered)
+        layer2_vblank();
+
+        // Advance copper parallax bands (no-op when no bands are set up)
+        copper_parallax_update();
 
         input = input_read();
 
@@ -169,6 +181,13 @@ int main(void) {
                 game_render();
                 sound_update();
 
+                // Background regeneration in the time left this frame;
+                // once presented, go back to drawing on screen (overlay)
+                if (!layer2_bg_job_step()) {
+                    layer2_set_double_buffer(0);
+                }
+                director_frame_end();
+
                 // Apply shake when shake_timer active (holes or crashes)
                 if (game.shake_timer > 0) {
                     apply_shake();
@@ -214,6 +233,7 @@ int main(void) {
                 game_update_dying();
                 game_render_dying();
                 sound_update();
+                director_frame_end();
 
                 // Apply shake if still active
                 if (game.shake_timer > 0) {
@@ -236,9 +256,7 @@ int main(void) {
                 if (!state_text_shown) {
                     state_text_shown = 1;
                     // Hide all sprites
-                    for (uint8_t s = 0; s < 32; s++) {
-                        sprite_hide(s);
-                    }
+                    sprites_hide_from(0);
                     disable_gameplay();
                     draw_gameover();
                 }
@@ -0,0 +1,128 @@
+#include <stdint.h>
+#include "overlay.h"
+#include "layer2.h"
+#include "game.h"
+
+// Saved background rectangle (Layer 2 buffer coordinates)
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+    uint16_t offset;  // Start of saved pixels in the pool
+} OverlayRect;
+
+static OverlayRect overlay_rects[OVERLAY_MAX_RECTS];
+static uint8_t overlay_count = 0;
+
+// Saved background pixels, bump allocated and reset every frame
+static uint8_t overlay_pool[OVERLAY_POOL_SIZE];
+static uint16_t overlay_used = 0;
+
+// Forget all saved rectangles
+void overlay_init(void) {
+    overlay_count = 0;
+    overlay_used = 0;
+}
+
+// Restore the background under last frame's effects
+// Reverse order so overlapping effects unwind correctly
+void overlay_restore(void) {
+    OverlayRect *r;
+
+    while (overlay_count > 0) {
+        r = &overlay_rects[--overlay_count];
+        layer2_blit(r->x, r->y, r->w, r->h, overlay_pool + r->offset);
+    }
+
+    overlay_used = 0;
+}
+
+// Save, then draw one piece already in buffer coordinates
+// src is NULL for a solid fill
+static void overlay_piece(uint8_t bx, uint8_t by, uint8_t w, uint8_t h,
+                          const uint8_t *src, uint8_t stride, uint8_t color) {
+    OverlayRect *r = &overlay_rects[overlay_count++];
+
+    r->x = bx;
+    r->y = by;
+    r->w = w;
+    r->h = h;
+    r->offset = overlay_used;
+
+    layer2_read_rect(bx, by, w, h, overlay_pool + overlay_used);
+    if (src) {
+        layer2_blit_sub(bx, by, w, h, src, stride, OVERLAY_TRANSPARENT);
+    }
+    else {
+        layer2_fill_rect(bx, by, w, h, color);
+    }
+
+    overlay_used += (uint16_t)w * h;
+}
+
+// Map a screen rectangle into the scrolled Layer 2 buffer and draw it
+// The buffer wraps at 256 columns and 192 lines, so a rectangle may
+// split into up to four pieces
+static uint8_t overlay_draw(int16_t x, int16_t y, uint8_t w, uint8_t h,
+                            const uint8_t *src, uint8_t color) {
+    uint8_t stride = w;
+    uint8_t bx, by;
+    uint8_t w1, h1;
+
+    // Wrap mode, back buffer or a background job: nothing to draw over
+    if (!layer2_is_direct()) return 0;
+
+    // Clip to screen
+    if (x < 0) {
+        if (x + w <= 0) return 1;
+        if (src) src += (uint8_t)(-x);
+        w = (uint8_t)(w + x);
+        x = 0;
+    }
+    if (y < 0) {
+        if (y + h <= 0) return 1;
+        if (src) src += (uint16_t)(-y) * stride;
+        h = (uint8_t)(h + y);
+        y = 0;
+    }
+    if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return 1;
+    if (x + w > SCREEN_WIDTH) w = (uint8_t)(SCREEN_WIDTH - x);
+    if (y + h > SCREEN_HEIGHT) h = (uint8_t)(SCREEN_HEIGHT - y);
+
+    // Check room for the worst case before drawing anything
+    if (overlay_count + 4 > OVERLAY_MAX_RECTS) return 0;
+    if (overlay_used + (uint16_t)w * h > OVERLAY_POOL_SIZE) return 0;
+
+    // Screen to buffer coordinates
+    bx = (uint8_t)x + layer2_get_scroll_x();
+    by = (uint8_t)(((uint16_t)y + layer2_get_scroll_y()) % SCREEN_HEIGHT);
+
+    // Split at the right and bottom buffer edges
+    w1 = (bx + w > 256) ? (uint8_t)(256 - bx) : w;
+    h1 = (by + h > SCREEN_HEIGHT) ? (uint8_t)(SCREEN_HEIGHT - by) : h;
+
+    overlay_piece(bx, by, w1, h1, src, stride, color);
+    if (w1 < w) {
+        overlay_piece(0, by, w - w1, h1, src ? src + w1 : 0, stride, color);
+    }
+    if (h1 < h) {
+        if (src) src += (uint16_t)h1 * stride;
+        overlay_piece(bx, 0, w1, h - h1, src, stride, color);
+        if (w1 < w) {
+            overlay_piece(0, 0, w - w1, h - h1, src ? src + w1 : 0, stride, color);
+        }
+    }
+
+    return 1;
+}
+
+// Draw an image at a screen position
+uint8_t overlay_blit(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t *src) {
+    return overlay_draw(x, y, w, h, src, 0);
+}
+
+// Fill a solid rectangle at a screen position
+uint8_t overlay_fill(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color) {
+    return overlay_draw(x, y, w, h, 0, color);
+}
@@ -0,0 +1,36 @@
+#ifndef OVERLAY_H
+#define OVERLAY_H
+
+#include <stdint.h>
+
+// Layer 2 overlay for transient effects (debris, craters, score pop-ups)
+// The background under each effect is saved into a small pool and put
+// back by overlay_restore() next frame, so cost scales with effect area
+// rather than the screen. Works on the 256x192 single-buffered Layer 2;
+// effects are skipped while layer2_is_direct() is 0.
+
+#define OVERLAY_MAX_RECTS   16     // Saved rectangles per frame
+#define OVERLAY_POOL_SIZE   2048   // Bytes of saved background per frame
+
+// Overlay image transparent colour
+#define OVERLAY_TRANSPARENT 0xE3
+
+// Forget all saved rectangles (call when the background is redrawn)
+void overlay_init(void);
+
+// Restore the background under last frame's effects
+// Call once per frame before drawing new effects
+void overlay_restore(void);
+
+// Draw an image at a screen position, skipping OVERLAY_TRANSPARENT
+// Screen coordinates follow the current Layer 2 scroll
+// Returns 0 if the effect did not fit in the pool or Layer 2 is not
+// direct (not drawn)
+uint8_t overlay_blit(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t *src);
+
+// Fill a solid rectangle at a screen position
+// Returns 0 if the effect did not fit in the pool or Layer 2 is not
+// direct (not drawn)
+uint8_t overlay_fill(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color);
+
+#endif // OVERLAY_H
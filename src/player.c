@@ -8,9 +8,20 @@
 Player player;
 
 // Initialize player to starting position
+// Sprite slots: shadow (anchor) + player (relative), kept for the whole game
+static uint8_t player_sprite = SPRITE_SLOT_NONE;
+
 void player_init(void) {
+    if (player_sprite == SPRITE_SLOT_NONE) {
+        player_sprite = sprite_alloc(SPRITE_BAND_AIR, 2);
+    }
+
     player.x = PLAYER_START_X;
     player.y = PLAYER_START_Y;
+    player.xf = 0;
+    player.yf = 0;
+    player.vx = 0;
+    player.vy = 0;
     player.lives = PLAYER_MAX_LIVES;
     player.shield = 0;
     player.fire_cooldown = 0;
@@ -30,38 +41,33 @@ static uint8_t is_valid_position(int16_t x, int16_t y) {
 uint8_t player_update(uint8_t input) {
     uint8_t fire = 0;
     int16_t new_x, new_y;
-
-    // Update player position - check tile before allowing move
-    if (input & INPUT_UP) {
-        if (player.y > GAME_TOP) {
-            new_y = player.y - PLAYER_SPEED;
-            if (is_valid_position(player.x, new_y)) {
-                player.y = new_y;
-            }
-        }
-    }
-    if (input & INPUT_DOWN) {
-        if (player.y < GAME_BOTTOM - PLAYER_HEIGHT) {
-            new_y = player.y + PLAYER_SPEED;
-            if (is_valid_position(player.x, new_y)) {
-                player.y = new_y;
-            }
+    uint8_t new_f;
+
+    // Velocity from input (8.8), stopped at the game area edges
+    player.vx = 0;
+    player.vy = 0;
+    if ((input & INPUT_UP) && player.y > GAME_TOP) player.vy = -PLAYER_SPEED;
+    if ((input & INPUT_DOWN) && player.y < GAME_BOTTOM - PLAYER_HEIGHT) player.vy = PLAYER_SPEED;
+    if ((input & INPUT_LEFT) && player.x > GAME_LEFT) player.vx = -PLAYER_SPEED;
+    if ((input & INPUT_RIGHT) && player.x < GAME_RIGHT - PLAYER_WIDTH) player.vx = PLAYER_SPEED;
+
+    // Integrate each axis - check tile before allowing move
+    if (player.vy != 0) {
+        new_y = player.y;
+        new_f = player.yf;
+        FIX_INTEGRATE(new_y, new_f, player.vy);
+        if (is_valid_position(player.x, new_y)) {
+            player.y = new_y;
+            player.yf = new_f;
         }
     }
-    if (input & INPUT_LEFT) {
-        if (player.x > GAME_LEFT) {
-            new_x = player.x - PLAYER_SPEED;
-            if (is_valid_position(new_x, player.y)) {
-                player.x = new_x;
-            }
-        }
-    }
-    if (input & INPUT_RIGHT) {
-        if (player.x < GAME_RIGHT - PLAYER_WIDTH) {
-            new_x = player.x + PLAYER_SPEED;
-            if (is_valid_position(new_x, player.y)) {
-                player.x = new_x;
-            }
+    if (player.vx != 0) {
+        new_x = player.x;
+        new_f = player.xf;
+        FIX_INTEGRATE(new_x, new_f, player.vx);
+        if (is_valid_position(new_x, player.y)) {
+            player.x = new_x;
+            player.xf = new_f;
         }
     }
 
@@ -132,28 +138,28 @@ void player_reset_position(void) {
     // Reset to center of current lane(s)
     level_get_boundaries(&left, &right);
     player.x = (left + right) / 2 - (PLAYER_WIDTH / 2);
+    player.xf = 0;
 }
 
 // Render player and shadow
-// Returns next available sprite slot
-uint8_t player_render(uint8_t sprite_slot) {
+// The shadow is the anchor, the player a relative sprite drawn on top
+void player_render(void) {
+    if (player_sprite == SPRITE_SLOT_NONE) return;
+
     // Render player shadow first (behind player)
     if (player.invincible == 0 || (player.invincible & 0x04)) {
-        sprite_set(sprite_slot++, player.x + SHADOW_OFFSET_X, player.y + SHADOW_OFFSET_Y, SPRITE_SHADOW);
-        sprite_set(sprite_slot++, player.x, player.y, SPRITE_PLAYER);
+        sprite_set(player_sprite, player.x + SHADOW_OFFSET_X, player.y + SHADOW_OFFSET_Y, SPRITE_SHADOW);
+        sprite_set_relative(player_sprite + 1, -SHADOW_OFFSET_X, -SHADOW_OFFSET_Y, SPRITE_PLAYER, 0);
     }
     else {
-        sprite_hide(sprite_slot++);
-        sprite_hide(sprite_slot++);
+        player_hide();
     }
-
-    return sprite_slot;
 }
 
-// Hide player sprites
-// Returns next available sprite slot
-uint8_t player_hide(uint8_t sprite_slot) {
-    sprite_hide(sprite_slot++);
-    sprite_hide(sprite_slot++);
-    return sprite_slot;
+// Hide player sprites (slots stay allocated)
+void player_hide(void) {
+    if (player_sprite == SPRITE_SLOT_NONE) return;
+
+    sprite_hide(player_sprite);
+    sprite_hide(player_sprite + 1);
 }
@@ -25,13 +25,11 @@ uint8_t player_hit(void);
 // Reset player to center after crash
 void player_reset_position(void);
 
-// Render player and shadow
-// Returns next available sprite slot
-uint8_t player_render(uint8_t sprite_slot);
+// Render player and shadow (in its own allocated sprite slots)
+void player_render(void);
 
 // Hide player sprites
-// Returns next available sprite slot
-uint8_t player_hide(uint8_t sprite_slot);
+void player_hide(void);
 
 // Global player
 extern Player player;
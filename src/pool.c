@@ -0,0 +1,42 @@
+#include <stdint.h>
+#include "pool.h"
+
+// Reset the pool: all ids free, lowest ids handed out first
+void pool_init(Pool *pool, uint8_t capacity) {
+    uint8_t i;
+
+    pool->count = 0;
+    pool->capacity = capacity;
+    for (i = 0; i < capacity; i++) {
+        pool->index[i] = POOL_NONE;
+        pool->free[i] = capacity - 1 - i;
+    }
+}
+
+// Take a free id: pop the free stack, append to the live list
+uint8_t pool_alloc(Pool *pool) {
+    uint8_t id;
+
+    if (pool->count == pool->capacity) return POOL_NONE;
+
+    id = pool->free[pool->capacity - pool->count - 1];
+    pool->live[pool->count] = id;
+    pool->index[id] = pool->count;
+    pool->count++;
+    return id;
+}
+
+// Return a live id: the last live id fills its place in the live list
+void pool_release(Pool *pool, uint8_t id) {
+    uint8_t n = pool->index[id];
+    uint8_t last;
+
+    if (n == POOL_NONE) return;
+
+    pool->count--;
+    last = pool->live[pool->count];
+    pool->live[n] = last;
+    pool->index[last] = n;
+    pool->index[id] = POOL_NONE;
+    pool->free[pool->capacity - pool->count - 1] = id;
+}
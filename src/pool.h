@@ -0,0 +1,41 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdint.h>
+
+// Fixed-size id pool for entity arrays stored as structure of arrays.
+// Live ids are kept dense in live[0..count-1] and free ids on a stack,
+// so spawning, killing and iterating cost O(1) per entity instead of a
+// scan over every slot.
+//
+// Iterate live entities backwards so pool_release inside the loop is safe
+// (the released entry is replaced by one that was already visited):
+//   for (n = pool.count; n-- > 0;) { id = pool.live[n]; ... }
+
+#define POOL_MAX   32     // Largest capacity (raise for bigger pools)
+#define POOL_NONE  0xFF   // No id / id not live
+
+typedef struct {
+    uint8_t count;              // Number of live ids
+    uint8_t capacity;
+    uint8_t live[POOL_MAX];     // Dense list of live ids
+    uint8_t index[POOL_MAX];    // Position of each id in live[], POOL_NONE if free
+    uint8_t free[POOL_MAX];     // Free id stack (capacity - count entries)
+} Pool;
+
+// Non-zero if id is live
+#define POOL_IS_LIVE(p, id)  ((p)->index[id] != POOL_NONE)
+
+// Free pool slots
+#define POOL_FREE(p)         ((p)->capacity - (p)->count)
+
+// Reset the pool: all ids free, lowest ids handed out first
+void pool_init(Pool *pool, uint8_t capacity);
+
+// Take a free id (POOL_NONE if the pool is full)
+uint8_t pool_alloc(Pool *pool);
+
+// Return a live id to the free stack
+void pool_release(Pool *pool, uint8_t id);
+
+#endif // POOL_H
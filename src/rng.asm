@@ -0,0 +1,37 @@
+; 16-bit xorshift (7, 9, 8) step
+;
+; uint16_t rng_step(uint16_t *state) __z88dk_fastcall
+;
+; Same result as x ^= x << 7; x ^= x >> 9; x ^= x << 8, done with byte
+; rotates: XOR clears carry, so the second RRA pair shifts in the right
+; bits. Stores and returns the new state in HL. Uses AF, DE.
+
+SECTION code_user
+
+PUBLIC _rng_step
+
+_rng_step:
+    ld e,(hl)               ; DE = x
+    inc hl
+    ld d,(hl)
+
+    ld a,d
+    rra
+    ld a,e
+    rra
+    xor d
+    ld d,a
+    ld a,e
+    rra
+    ld a,d
+    rra
+    xor e
+    ld e,a
+    xor d
+    ld d,a
+
+    ld (hl),d               ; store new state
+    dec hl
+    ld (hl),e
+    ex de,hl
+    ret
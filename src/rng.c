@@ -0,0 +1,19 @@
+#include <stdint.h>
+#include "rng.h"
+
+// Stream states (boot defaults until rng_seed_level)
+uint16_t rng_state[RNG_STREAM_COUNT] = { 0x1234, 0xACE1, 12345 };
+
+// Set a stream's seed
+void rng_seed(uint8_t stream, uint16_t seed) {
+    rng_state[stream] = seed ? seed : 1;
+}
+
+// Seed every stream from the level number
+void rng_seed_level(uint8_t level) {
+    uint8_t i;
+
+    for (i = 0; i < RNG_STREAM_COUNT; i++) {
+        rng_seed(i, ((uint16_t)level << 8 | i) ^ 0x5A3C);
+    }
+}
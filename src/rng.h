@@ -0,0 +1,32 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+// Random numbers: 16-bit xorshift (7, 9, 8) with independent streams,
+// so effects or background drawing never change the spawn sequence.
+// One step is a handful of byte rotates and XORs (rng.asm), no multiply.
+// Period 65535; a stream's state is never 0.
+
+#define RNG_SPAWN         0   // Enemy spawns and formations
+#define RNG_EFFECTS       1   // Sprite effects
+#define RNG_LEVEL         2   // Level and background generation
+#define RNG_STREAM_COUNT  3
+
+extern uint16_t rng_state[RNG_STREAM_COUNT];
+
+// Advance a state and return the new value (rng.asm)
+uint16_t rng_step(uint16_t *state) __z88dk_fastcall;
+
+// Next 16 / 8 random bits from a stream
+#define rng_next(stream)  rng_step(&rng_state[stream])
+#define rng8(stream)      ((uint8_t)rng_step(&rng_state[stream]))
+
+// Set a stream's seed (0 is replaced, it would stick at 0)
+void rng_seed(uint8_t stream, uint16_t seed);
+
+// Seed every stream from the level number, so a level plays the same
+// way for the same inputs
+void rng_seed_level(uint8_t level);
+
+#endif // RNG_H
@@ -0,0 +1,102 @@
+#include <stdint.h>
+#include "shot.h"
+#include "player.h"
+#include "sprites.h"
+
+// Global shot pool
+Shots shots;
+
+// Sprite slot per shot (allocated while the shot is live)
+static uint8_t shot_sprite[MAX_SHOTS];
+
+// Shots fired since the last shots_update
+static uint8_t shots_this_frame = 0;
+
+// Initialize enemy shots (clear all)
+void shots_init(void) {
+    uint8_t n;
+
+    // Release slots left from the previous game
+    for (n = 0; n < shots.pool.count; n++) {
+        sprite_free(shot_sprite[shots.pool.live[n]], 1);
+    }
+    pool_init(&shots.pool, MAX_SHOTS);
+    shots_this_frame = 0;
+}
+
+// Remove a live shot and release its sprite slot
+void shot_kill(uint8_t id) {
+    sprite_free(shot_sprite[id], 1);
+    pool_release(&shots.pool, id);
+}
+
+// Fire a shot from x, y toward the player's centre
+void shots_fire(int16_t x, int16_t y) {
+    uint8_t i, angle;
+
+    if (shots_this_frame >= SHOTS_PER_FRAME) return;
+
+    i = pool_alloc(&shots.pool);
+    if (i == POOL_NONE) return;
+    shots_this_frame++;
+
+    angle = fix_atan2(player.x + (PLAYER_WIDTH / 2) - x,
+                      player.y + (PLAYER_HEIGHT / 2) - y);
+
+    shots.x[i] = x;
+    shots.y[i] = y;
+    shots.xf[i] = 0;
+    shots.yf[i] = 0;
+    shots.vx[i] = fix_mul(FIX_COS(angle), SHOT_SPEED >> 7);
+    shots.vy[i] = fix_mul(FIX_SIN(angle), SHOT_SPEED >> 7);
+    shots.row[i] = SHOT_ROW(y);
+    shot_sprite[i] = SPRITE_SLOT_NONE;
+}
+
+// Move shots, update their broadphase rows, remove those off screen
+void shots_update(void) {
+    uint8_t n, i;
+
+    for (n = shots.pool.count; n-- > 0;) {
+        i = shots.pool.live[n];
+        FIX_INTEGRATE(shots.x[i], shots.xf[i], shots.vx[i]);
+        FIX_INTEGRATE(shots.y[i], shots.yf[i], shots.vy[i]);
+
+        if (shots.x[i] < GAME_LEFT - 8 || shots.x[i] > GAME_RIGHT + 24 ||
+            shots.y[i] < -8 || shots.y[i] > SCREEN_HEIGHT + 8) {
+            shot_kill(i);
+            continue;
+        }
+        shots.row[i] = SHOT_ROW(shots.y[i]);
+    }
+
+    // New frame for the fire rate limit
+    shots_this_frame = 0;
+}
+
+// Render shots: the bullet pattern in the hot palette, centred on x, y
+// Live shots get a slot on first render; shot_kill releases it
+void shots_render(void) {
+    uint8_t n, i;
+
+    for (n = 0; n < shots.pool.count; n++) {
+        i = shots.pool.live[n];
+        if (shot_sprite[i] == SPRITE_SLOT_NONE) {
+            shot_sprite[i] = sprite_alloc(SPRITE_BAND_SHOTS, 1);
+            if (shot_sprite[i] == SPRITE_SLOT_NONE) continue;
+        }
+        sprite_set_flags(shot_sprite[i], shots.x[i] - 8, shots.y[i] - 8, SPRITE_BULLET,
+                         SPRITE_PALETTE(PALETTE_ENEMY_FAST));
+    }
+}
+
+// Hide all shot sprites (releases their slots)
+void shots_hide(void) {
+    uint8_t n, i;
+
+    for (n = 0; n < shots.pool.count; n++) {
+        i = shots.pool.live[n];
+        sprite_free(shot_sprite[i], 1);
+        shot_sprite[i] = SPRITE_SLOT_NONE;
+    }
+}
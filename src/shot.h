@@ -0,0 +1,47 @@
+#ifndef SHOT_H
+#define SHOT_H
+
+#include <stdint.h>
+#include "game.h"
+#include "pool.h"
+
+// Enemy shot storage: one array per field, indexed by shot id
+// Live ids are listed in pool.live[0..pool.count-1]
+typedef struct {
+    Pool pool;
+    int16_t x[MAX_SHOTS];       // Centre
+    int16_t y[MAX_SHOTS];
+    uint8_t xf[MAX_SHOTS];      // 8.8 fractions of x, y
+    uint8_t yf[MAX_SHOTS];
+    int16_t vx[MAX_SHOTS];      // 8.8 velocity
+    int16_t vy[MAX_SHOTS];
+    uint8_t row[MAX_SHOTS];     // SHOT_ROW bit for the collision broadphase
+} Shots;
+
+// Broadphase row bit: the screen is split into 32 pixel bands
+// (valid for y -32..223, shots are removed before leaving that range)
+#define SHOT_ROW(y)  ((uint8_t)(1 << ((uint8_t)((y) + 32) >> 5)))
+
+// Initialize enemy shots (clear all)
+void shots_init(void);
+
+// Fire a shot from x, y (centre) toward the player
+// Ignored when the pool is full or SHOTS_PER_FRAME shots were fired
+void shots_fire(int16_t x, int16_t y);
+
+// Move shots and remove those that leave the screen
+void shots_update(void);
+
+// Remove a live shot and release its sprite slot
+void shot_kill(uint8_t id);
+
+// Render shots using sprites (slots from the shots band)
+void shots_render(void);
+
+// Hide all shot sprites and release their slots
+void shots_hide(void);
+
+// Global shot pool
+extern Shots shots;
+
+#endif // SHOT_H
@@ -0,0 +1,150 @@
+; Generated from PNG: 16 sprites (16x16, 4-bit), 2048 bytes
+; Pages: 44-44
+
+SECTION PAGE_44
+PUBLIC _sprite_patterns_page44
+_sprite_patterns_page44:
+    ; sprite_A0
+    defb 0xbb, 0xbb, 0xbb, 0xff, 0xbf, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xbf, 0xbf, 0xbf, 0xfb, 0xbb
+    defb 0xbb, 0xbf, 0xff, 0xfb, 0xab, 0xff, 0xff, 0xbb, 0xbb, 0xff, 0xfb, 0xbb, 0xab, 0xbb, 0xff, 0xfb
+    defb 0xbb, 0xff, 0xbb, 0xba, 0xaa, 0xbb, 0xbf, 0xfb, 0xbf, 0xbb, 0xbb, 0xba, 0xaa, 0xbb, 0xbb, 0xbf
+    defb 0xbf, 0xfb, 0xbb, 0xba, 0xaa, 0xbb, 0xbb, 0xff, 0xbf, 0xfb, 0xbb, 0xba, 0xaa, 0xbb, 0xbb, 0xff
+    defb 0xbf, 0xbb, 0xbb, 0xba, 0xaa, 0xbb, 0xbb, 0xbf, 0xbb, 0xff, 0xbb, 0xba, 0xaa, 0xbb, 0xbf, 0xfb
+    defb 0xbb, 0xff, 0xfb, 0xbb, 0xab, 0xbb, 0xff, 0xfb, 0xbb, 0xbf, 0xff, 0xfb, 0xab, 0xff, 0xff, 0xbb
+    defb 0xbb, 0xbb, 0xff, 0xbf, 0xbf, 0xbf, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xbf, 0xfb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_B0
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xbf, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbf, 0xbf, 0xbf, 0xbf, 0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xfb, 0xbb, 0xff, 0xff, 0xbb
+    defb 0xbb, 0xff, 0xfb, 0xba, 0xaa, 0xbb, 0xff, 0xfb, 0xbb, 0xbf, 0xbb, 0xaa, 0xaa, 0xab, 0xbf, 0xbb
+    defb 0xbf, 0xfb, 0xbb, 0xaa, 0xaa, 0xab, 0xbb, 0xff, 0xbf, 0xfb, 0xbb, 0xaa, 0xaa, 0xab, 0xbb, 0xff
+    defb 0xbb, 0xbf, 0xbb, 0xaa, 0xaa, 0xab, 0xbf, 0xbb, 0xbb, 0xff, 0xfb, 0xba, 0xaa, 0xbb, 0xff, 0xfb
+    defb 0xbb, 0xbf, 0xff, 0xba, 0xaa, 0xbf, 0xff, 0xbb, 0xbb, 0xbb, 0xbf, 0xbb, 0xab, 0xbf, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbf, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_C0
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xbf, 0xbf, 0xbf, 0xbb, 0xbb
+    defb 0xbb, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbb, 0xbb, 0xff, 0xfb, 0xbb, 0xbb, 0xbb, 0xff, 0xfb
+    defb 0xbf, 0xbb, 0xba, 0xaa, 0xaa, 0xaa, 0xbb, 0xbf, 0xbf, 0xfb, 0xba, 0xaa, 0xaa, 0xaa, 0xbb, 0xff
+    defb 0xbb, 0xbf, 0xba, 0xaa, 0xaa, 0xaa, 0xbf, 0xbb, 0xbb, 0xbf, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_D0
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xff, 0xff, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbf, 0xff, 0xff, 0xba, 0xba, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xba, 0xba, 0xbf, 0xff, 0xff
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbb
+    defb 0xbb, 0xbb, 0xbf, 0xff, 0xff, 0xff, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_E0
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xfb, 0xbb, 0xbb
+    defb 0xbb, 0xbf, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xbb, 0xbb, 0xbf, 0xba, 0xaa, 0xaa, 0xaa, 0xbf, 0xbb
+    defb 0xbf, 0xfb, 0xba, 0xaa, 0xaa, 0xaa, 0xbb, 0xff, 0xbf, 0xbb, 0xba, 0xaa, 0xaa, 0xaa, 0xbb, 0xbf
+    defb 0xbb, 0xff, 0xfb, 0xbb, 0xbb, 0xbb, 0xff, 0xfb, 0xbb, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbb
+    defb 0xbb, 0xbb, 0xbf, 0xbf, 0xbf, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_F0
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xbf, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbf, 0xbb, 0xfb, 0xbf, 0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xba, 0xaa, 0xbf, 0xff, 0xbb
+    defb 0xbb, 0xff, 0xfb, 0xba, 0xaa, 0xbb, 0xff, 0xfb, 0xbb, 0xbf, 0xbb, 0xaa, 0xaa, 0xab, 0xbf, 0xbb
+    defb 0xbf, 0xfb, 0xbb, 0xaa, 0xaa, 0xab, 0xbb, 0xff, 0xbf, 0xfb, 0xbb, 0xaa, 0xaa, 0xab, 0xbb, 0xff
+    defb 0xbb, 0xbf, 0xbb, 0xaa, 0xaa, 0xab, 0xbf, 0xbb, 0xbb, 0xff, 0xfb, 0xba, 0xaa, 0xbb, 0xff, 0xfb
+    defb 0xbb, 0xbf, 0xff, 0xfb, 0xbb, 0xff, 0xff, 0xbb, 0xbb, 0xbb, 0xbf, 0xbf, 0xbf, 0xbf, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbf, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_G0
+    defb 0xbb, 0xbb, 0xbb, 0xff, 0xbf, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xbf, 0xbf, 0xbf, 0xfb, 0xbb
+    defb 0xbb, 0xbf, 0xff, 0xfb, 0xab, 0xff, 0xff, 0xbb, 0xbb, 0xff, 0xfb, 0xbb, 0xab, 0xbb, 0xff, 0xfb
+    defb 0xbb, 0xff, 0xbb, 0xba, 0xaa, 0xbb, 0xbf, 0xfb, 0xbf, 0xbb, 0xbb, 0xba, 0xaa, 0xbb, 0xbb, 0xbf
+    defb 0xbf, 0xfb, 0xbb, 0xba, 0xaa, 0xbb, 0xbb, 0xff, 0xbf, 0xfb, 0xbb, 0xba, 0xaa, 0xbb, 0xbb, 0xff
+    defb 0xbf, 0xbb, 0xbb, 0xba, 0xaa, 0xbb, 0xbb, 0xbf, 0xbb, 0xff, 0xbb, 0xba, 0xaa, 0xbb, 0xbf, 0xfb
+    defb 0xbb, 0xff, 0xfb, 0xbb, 0xab, 0xbb, 0xff, 0xfb, 0xbb, 0xbf, 0xff, 0xfb, 0xab, 0xff, 0xff, 0xbb
+    defb 0xbb, 0xbb, 0xff, 0xbf, 0xbf, 0xbf, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xbf, 0xfb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_H0
+    defb 0xbb, 0xbb, 0xbb, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xfb, 0xbb, 0xbf, 0xbb, 0xbb, 0xfb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xff, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xfb, 0xbb, 0xf0, 0xfb, 0xbb, 0xfb, 0xbb
+    defb 0xbb, 0xfb, 0xbf, 0x0f, 0x0f, 0xbb, 0xfb, 0xbb, 0xbb, 0xff, 0xbf, 0xf0, 0xff, 0xbf, 0xfb, 0xbb
+    defb 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbb, 0xbb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfb, 0xbb
+    defb 0xbf, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xfb
+    defb 0xbb, 0xb0, 0xf0, 0xf0, 0xf0, 0xf0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x0f, 0x0b, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xb0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_A1
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xb1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xb1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x1b, 0xbb, 0x1b, 0x1b, 0xbb, 0x1b, 0xbb
+    defb 0xbb, 0xbb, 0xb1, 0xb1, 0xb1, 0xbb, 0xbb, 0xbb, 0xbb, 0x1b, 0xbb, 0x1b, 0x1b, 0xbb, 0x1b, 0xbb
+    defb 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0xbb, 0xbb, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0xbb
+    defb 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b
+    defb 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x1b, 0x1b, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xb1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_B1
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xba, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xab, 0xbb, 0xbe, 0xbb, 0xbb, 0xab, 0xbb, 0xbb, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xeb, 0xbb
+    ; sprite_C1
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0x1b, 0x1b, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0xbb, 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb
+    defb 0xbb, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb
+    defb 0xbb, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb
+    defb 0xbb, 0xbb, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0xbb, 0xbb, 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0x1b, 0x1b, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_D1
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_E1
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_F1
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_G1
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    ; sprite_H1
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
+    defb 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
@@ -2,7 +2,9 @@
 #include <z80.h>
 #include <intrinsic.h>
 #include <stdint.h>
+#include <string.h>
 #include "game.h"
+#include "sprites.h"
 #include "spriteset.h"
 
 // ZX Spectrum Next I/O ports
@@ -12,6 +14,68 @@
 
 // Next register values
 #define NEXTREG_SPRITE_SYSTEM  0x15
+#define NEXTREG_SPRITE_TRANS   0x4B
+#define MMU_SLOT3_REG          0x53
+
+// Pattern cache
+// Patterns are referenced by ID (spriteset.h) and copied from banked
+// memory into a free hardware pattern slot on first use.
+#define SPRITE_PATTERN_NONE       0xFF
+
+#if SPRITESET_4BIT
+// 4-bit patterns: 128 slots of 128 bytes (two per 256 byte pattern slot)
+// Slot n is pattern N5-N0 = n / 2 with N6 selecting the 128 byte half
+#define SPRITE_PATTERN_SLOTS      128
+#define SPRITE_UPLOADS_PER_FRAME  8    // 128 bytes each
+#define PATTERN_SELECT(hw)        (((hw) >> 1) | (((hw) & 1) << 7))
+#define PATTERN_ATTR3(hw)         ((hw) >> 1)
+#define PATTERN_ANCHOR_ATTR4(hw)  (0x80 | (((hw) & 1) << 6))   // H=1, N6
+#define PATTERN_REL_ATTR4(hw)     (((hw) & 1) << 5)            // N6
+#else
+#define SPRITE_PATTERN_SLOTS      64
+#define SPRITE_UPLOADS_PER_FRAME  4    // 256 bytes each
+#define PATTERN_SELECT(hw)        (hw)
+#define PATTERN_ATTR3(hw)         (hw)
+#define PATTERN_ANCHOR_ATTR4(hw)  0
+#define PATTERN_REL_ATTR4(hw)     0
+#endif
+
+// Attribute bytes per sprite (5-byte mode)
+#define SPRITE_ATTR_SIZE      5
+
+// RAM mirror of the sprite attribute table
+// sprite_set/sprite_hide only write here; sprites_flush() sends the
+// changed part to the hardware in one burst at vblank.
+static uint8_t sprite_attrs[SPRITE_MAX_SLOTS * SPRITE_ATTR_SIZE];
+
+// Slots sprite_dirty_lo to sprite_dirty_hi - 1 changed since the last flush
+static uint8_t sprite_dirty_lo = SPRITE_MAX_SLOTS;
+static uint8_t sprite_dirty_hi = 0;
+
+// Slots at or above sprite_visible_top are hidden
+static uint8_t sprite_visible_top = 0;
+
+// Slot allocator: priority bands (higher slots are drawn on top)
+static const uint8_t band_first[SPRITE_BAND_COUNT] = { 0, 16, 96, 112 };
+static const uint8_t band_end[SPRITE_BAND_COUNT] = { 16, 96, 112, 128 };
+static uint8_t sprite_used[SPRITE_MAX_SLOTS];
+
+// Pattern ID -> hardware slot, and hardware slot -> pattern ID
+static uint8_t pattern_slot_of[SPRITESET_COUNT];
+static uint8_t pattern_id_in[SPRITE_PATTERN_SLOTS];
+
+// Frame each hardware slot was last used (for LRU eviction)
+static uint8_t pattern_last_used[SPRITE_PATTERN_SLOTS];
+static uint8_t pattern_clock = 0;
+static uint8_t pattern_uploads_left = 0;
+
+// External reference to banked pattern data (forces linker to include)
+extern uint8_t sprite_patterns_page44;
+
+void sprites_force_include(void) {
+    volatile uint8_t *ptr = &sprite_patterns_page44;
+    (void)ptr;
+}
 
 // 16x16 sprite patterns (256 bytes each, 8-bit per pixel)
 // Palette indices 0-15 are ZX Spectrum colors, 0xE3 is transparent
@@ -61,6 +125,13 @@ static const uint8_t zx_palette[16] = {
     0xFF   // 15: Bright White
 };
 
+// Sprite palette offset 1 (entries 16-31): ZX palette with white and
+// bright red swapped for bright red and bright yellow (fast enemies)
+static const uint8_t zx_palette_hot[16] = {
+    0x00, 0x02, 0xC0, 0xC2, 0x18, 0x1A, 0xD8, 0xDA,
+    0x49, 0x03, 0xFC, 0xE3, 0x1C, 0x1F, 0xFC, 0xE0
+};
+
 // Set up sprite palette
 // Register 0x43 palette control uses:
 //   bits 6-4: palette for reading (SELECT)
@@ -87,6 +158,9 @@ static void sprites_setup_palette(void) {
         if (i < 16) {
             color = zx_palette[i];
         }
+        else if (i < 32) {
+            color = zx_palette_hot[i - 16];
+        }
         else {
             color = (uint8_t)i;  // RGB332 identity
         }
@@ -100,80 +174,168 @@ static void sprites_setup_palette(void) {
 
 // Initialize sprite system
 void sprites_init(void) {
+    uint8_t i;
+
+    // Mirror starts as hidden records (E=1, see sprite_hide), all sent
+    // on the first flush
+    for (i = 0; i < SPRITE_MAX_SLOTS; i++) {
+        sprite_attrs[i * SPRITE_ATTR_SIZE + 3] = 0x40;
+    }
+    sprite_dirty_lo = 0;
+    sprite_dirty_hi = SPRITE_MAX_SLOTS;
+
     // Enable sprites, sprites visible, over border
     nextreg_write(NEXTREG_SPRITE_SYSTEM, 0x03);
 
     // Set up sprite palette
     sprites_setup_palette();
 
+    // Transparent index (only the low nibble is used by 4-bit sprites)
+    nextreg_write(NEXTREG_SPRITE_TRANS, SPRITE_TRANSPARENT);
+
     // Upload sprite patterns
     sprites_upload_patterns();
 }
 
-// Upload sprite patterns to pattern memory
-// 8-bit mode: 16x16 = 256 bytes per pattern
-void sprites_upload_patterns(void) {
-    uint16_t i;
+// Copy one pattern from banked memory into a hardware pattern slot
+// The pattern page is mapped to slot 3 (0x6000) for the transfer
+static void pattern_upload(uint8_t hw_slot, uint8_t id) {
+    const uint8_t *src;
+    uint8_t old_slot3;
 
-    // Select sprite pattern slot 0
-    z80_outp(SPRITE_SLOT_PORT, SPRITE_PLAYER);
+    intrinsic_di();
 
-    // Upload player sprite (H0 from spriteset)
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_H0[i]);
-    }
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    old_slot3 = IO_NEXTREG_DAT;
+    IO_NEXTREG_DAT = SPRITESET_PAGE + id / SPRITES_PER_PAGE;
 
-    // Upload bullet sprite (slot 1) - B1 from spriteset
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_B1[i]);
-    }
+    src = (const uint8_t *)0x6000 + (uint16_t)(id % SPRITES_PER_PAGE) * SPRITE_SIZE;
 
-    // Upload enemy animation frames A0-G0 (slots 2-8)
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_A0[i]);
-    }
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_B0[i]);
-    }
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_C0[i]);
+    // Select pattern slot, then stream the pattern (index auto-increments)
+    z80_outp(SPRITE_SLOT_PORT, PATTERN_SELECT(hw_slot));
+    z80_otir((void *)src, SPRITE_PATTERN_PORT, 128);
+#if !SPRITESET_4BIT
+    z80_otir((void *)(src + 128), SPRITE_PATTERN_PORT, 128);
+#endif
+
+    IO_NEXTREG_REG = MMU_SLOT3_REG;
+    IO_NEXTREG_DAT = old_slot3;
+
+    intrinsic_ei();
+
+    pattern_slot_of[id] = hw_slot;
+    pattern_id_in[hw_slot] = id;
+    pattern_last_used[hw_slot] = pattern_clock;
+}
+
+// Hardware slot holding a pattern ID, uploading it if needed
+// Evicts the least recently used slot (free slots first). Slots used this
+// frame or last frame are never evicted, since a visible sprite may still
+// show them. Returns SPRITE_PATTERN_NONE when the frame's upload budget is
+// spent or no slot can be evicted; the pattern is retried next frame.
+static uint8_t pattern_resolve(uint8_t id) {
+    uint8_t hw, victim, age, best_age;
+
+    hw = pattern_slot_of[id];
+    if (hw != SPRITE_PATTERN_NONE) {
+        pattern_last_used[hw] = pattern_clock;
+        return hw;
     }
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_D0[i]);
+
+    if (pattern_uploads_left == 0) return SPRITE_PATTERN_NONE;
+
+    victim = SPRITE_PATTERN_NONE;
+    best_age = 1;
+    for (hw = 0; hw < SPRITE_PATTERN_SLOTS; hw++) {
+        if (pattern_id_in[hw] == SPRITE_PATTERN_NONE) {
+            victim = hw;
+            break;
+        }
+
+        // Clock wraps every 256 frames, older patterns may look recent
+        age = pattern_clock - pattern_last_used[hw];
+        if (age > best_age) {
+            best_age = age;
+            victim = hw;
+        }
     }
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_E0[i]);
+
+    if (victim == SPRITE_PATTERN_NONE) return SPRITE_PATTERN_NONE;
+
+    if (pattern_id_in[victim] != SPRITE_PATTERN_NONE) {
+        pattern_slot_of[pattern_id_in[victim]] = SPRITE_PATTERN_NONE;
     }
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_F0[i]);
+
+    pattern_upload(victim, id);
+    pattern_uploads_left--;
+    return victim;
+}
+
+// Reset the pattern cache and preload the first patterns
+// The whole set is preloaded while it fits in the hardware slots, so
+// the cache only starts evicting once the sprite set grows past that.
+void sprites_upload_patterns(void) {
+    uint8_t i;
+
+    for (i = 0; i < SPRITESET_COUNT; i++) {
+        pattern_slot_of[i] = SPRITE_PATTERN_NONE;
     }
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_G0[i]);
+    for (i = 0; i < SPRITE_PATTERN_SLOTS; i++) {
+        pattern_id_in[i] = SPRITE_PATTERN_NONE;
     }
 
-    // Upload player shadow sprite (slot 9) - A1 from spriteset
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_A1[i]);
+    for (i = 0; i < SPRITESET_COUNT && i < SPRITE_PATTERN_SLOTS; i++) {
+        pattern_upload(i, i);
     }
+}
 
-    // Upload enemy shadow sprite (slot 10) - C1 from spriteset
-    for (i = 0; i < 256; i++) {
-        z80_outp(SPRITE_PATTERN_PORT, sprite_C1[i]);
+// Store 5 attribute bytes in the mirror
+// Only slots whose bytes actually change are marked for upload
+static void sprite_store(uint8_t slot, const uint8_t *bytes) {
+    uint8_t *attr = sprite_attrs + slot * SPRITE_ATTR_SIZE;
+
+    if (bytes[3] & 0x80) {
+        if (slot >= sprite_visible_top) sprite_visible_top = slot + 1;
     }
+
+    if (memcmp(attr, bytes, SPRITE_ATTR_SIZE) == 0) return;
+    memcpy(attr, bytes, SPRITE_ATTR_SIZE);
+
+    if (slot < sprite_dirty_lo) sprite_dirty_lo = slot;
+    if (slot >= sprite_dirty_hi) sprite_dirty_hi = slot + 1;
 }
 
-// Set sprite attributes (5-byte mode for 8-bit sprites)
+// Set sprite attributes (5-byte mode)
 void sprite_set(uint8_t slot, int16_t x, int16_t y, uint8_t pattern) {
+    sprite_set_flags(slot, x, y, pattern, 0);
+}
+
+// Set sprite attributes with palette offset / mirror / rotate flags
+void sprite_set_flags(uint8_t slot, int16_t x, int16_t y, uint8_t pattern, uint8_t flags) {
+    sprite_set_scaled(slot, x, y, pattern, flags, 0);
+}
+
+// Set sprite attributes with flags and hardware scaling
+// scale: SPRITE_SCALE(x, y) bits for attribute byte 4
+// pattern is a pattern ID; the sprite stays hidden this frame if the
+// pattern could not be uploaded yet
+void sprite_set_scaled(uint8_t slot, int16_t x, int16_t y, uint8_t pattern,
+                       uint8_t flags, uint8_t scale) {
+    uint8_t attr[SPRITE_ATTR_SIZE];
+
+    pattern = pattern_resolve(pattern);
+    if (pattern == SPRITE_PATTERN_NONE) {
+        sprite_hide(slot);
+        return;
+    }
+
     // Adjust coordinates for sprite offset (sprites are positioned from 32,32)
     x += 32;
     y += 32;
 
-    // Select sprite attribute slot
-    z80_outp(SPRITE_SLOT_PORT, slot);
-
-    // Write 5-byte sprite attributes (required for 8-bit sprites)
+    // 5-byte sprite attributes
     // Byte 2: PPPP XM YM R X8
-    //   Bits 7-4: Palette offset (0)
+    //   Bits 7-4: Palette offset
     //   Bit 3: X mirror
     //   Bit 2: Y mirror
     //   Bit 1: Rotate 90
@@ -182,24 +344,128 @@ void sprite_set(uint8_t slot, int16_t x, int16_t y, uint8_t pattern) {
     //   Bit 7: Visible
     //   Bit 6: E=1 for 5-byte mode
     //   Bits 5-0: Pattern number
-    // Byte 4: H N6 T 0 0 0 0 0
-    //   Bit 7: H (pattern bit 7)
-    //   Bit 6: N6 (pattern bit 6)
-    //   Bit 5: T=0 for 8-bit sprites
-    //   Bits 4-0: scaling=0 (1x), type=0 (anchor)
-    z80_outp(SPRITE_ATTR_PORT, x & 0xFF);           // Byte 0: X low byte
-    z80_outp(SPRITE_ATTR_PORT, y & 0xFF);           // Byte 1: Y low byte
-    z80_outp(SPRITE_ATTR_PORT, (x >> 8) & 0x01);    // Byte 2: X MSB only
-    z80_outp(SPRITE_ATTR_PORT, 0xC0 | (pattern & 0x3F));    // Byte 3: Visible, E=1, pattern[5:0]
-    z80_outp(SPRITE_ATTR_PORT, (pattern & 0x40) << 1);      // Byte 4: N6->bit7, T=0, no scaling
+    // Byte 4: H N6 T XX YY Y8
+    //   Bit 7: H=1 for 4-bit sprites
+    //   Bit 6: N6 (4-bit patterns: 128 byte half)
+    //   Bit 5: T=0 composite relative sprites
+    //   Bits 4-3: X scale, bits 2-1: Y scale (1x, 2x, 4x, 8x)
+    //   Bit 0: Y coordinate bit 8
+    attr[0] = x & 0xFF;                                     // Byte 0: X low byte
+    attr[1] = y & 0xFF;                                     // Byte 1: Y low byte
+    attr[2] = (flags & 0xFE) | ((x >> 8) & 0x01);           // Byte 2: flags, X MSB
+    attr[3] = 0xC0 | PATTERN_ATTR3(pattern);                // Byte 3: Visible, E=1, pattern[5:0]
+    attr[4] = PATTERN_ANCHOR_ATTR4(pattern) |               // Byte 4: H, N6,
+              (scale & 0x1E) | ((y >> 8) & 0x01);           //   scaling, Y MSB
+
+    sprite_store(slot, attr);
+}
+
+// Set a relative sprite attached to the nearest anchor below this slot
+// dx, dy: signed offset from the anchor position
+// Relative sprites follow the anchor in hardware (composite type) and are
+// only shown while the anchor is visible. 4-bit if the anchor is 4-bit.
+// flags: palette offset / mirror / rotate, as for sprite_set_flags
+void sprite_set_relative(uint8_t slot, int8_t dx, int8_t dy, uint8_t pattern, uint8_t flags) {
+    uint8_t attr[SPRITE_ATTR_SIZE];
+
+    pattern = pattern_resolve(pattern);
+    if (pattern == SPRITE_PATTERN_NONE) {
+        sprite_hide(slot);
+        return;
+    }
+
+    // Byte 4: 0 1 N6 X X Y Y PO
+    //   Bits 7-6: 01 = relative sprite
+    //   Bit 5: N6 (4-bit patterns only)
+    //   Bits 4-1: scaling=0 (1x)
+    //   Bit 0: PO=0 pattern number is absolute
+    attr[0] = (uint8_t)dx;                              // Byte 0: X offset
+    attr[1] = (uint8_t)dy;                              // Byte 1: Y offset
+    attr[2] = flags & 0xFE;                             // Byte 2: PPPP XM YM R, PR=0
+    attr[3] = 0xC0 | PATTERN_ATTR3(pattern);            // Byte 3: Visible, E=1, pattern[5:0]
+    attr[4] = 0x40 | PATTERN_REL_ATTR4(pattern);        // Byte 4: Relative, N6
+
+    sprite_store(slot, attr);
 }
 
 // Hide a sprite (5-byte mode)
+// Byte 3 keeps E=1 (bit 6) with V=0: with E=0 the hardware would read
+// only 4 bytes for this slot, misaligning every later slot in the flush.
 void sprite_hide(uint8_t slot) {
-    z80_outp(SPRITE_SLOT_PORT, slot);
-    z80_outp(SPRITE_ATTR_PORT, 0);
-    z80_outp(SPRITE_ATTR_PORT, 0);
-    z80_outp(SPRITE_ATTR_PORT, 0);
-    z80_outp(SPRITE_ATTR_PORT, 0);  // Invisible (bit 7 = 0)
-    z80_outp(SPRITE_ATTR_PORT, 0);  // Byte 4
+    static const uint8_t hidden[SPRITE_ATTR_SIZE] = { 0, 0, 0, 0x40, 0 };  // Invisible, E=1
+
+    sprite_store(slot, hidden);
+}
+
+// Hide every slot from first up to the highest visible one
+// Slots that are already hidden are skipped
+void sprites_hide_from(uint8_t first) {
+    while (sprite_visible_top > first) {
+        sprite_hide(--sprite_visible_top);
+    }
+}
+
+// Allocate count consecutive slots in a priority band
+// Consecutive slots keep anchor + relative sprites together.
+// Returns the first slot, or SPRITE_SLOT_NONE if the band is full.
+uint8_t sprite_alloc(uint8_t band, uint8_t count) {
+    uint8_t first = band_first[band];
+    uint8_t end = band_end[band];
+    uint8_t run = 0;
+    uint8_t slot;
+
+    for (slot = first; slot < end; slot++) {
+        if (sprite_used[slot]) {
+            run = 0;
+            continue;
+        }
+        if (++run == count) {
+            first = slot + 1 - count;
+            for (slot = first; slot < first + count; slot++) {
+                sprite_used[slot] = 1;
+            }
+            return first;
+        }
+    }
+    return SPRITE_SLOT_NONE;
+}
+
+// Hide and release slots from sprite_alloc
+void sprite_free(uint8_t first, uint8_t count) {
+    if (first == SPRITE_SLOT_NONE) return;
+
+    while (count--) {
+        sprite_hide(first);
+        sprite_used[first++] = 0;
+    }
+}
+
+// Send the changed part of the attribute mirror to the hardware
+// Also starts a new frame for the pattern cache (upload budget, LRU clock)
+// Selects the first changed slot and streams the changed range to port
+// 0x57 with OTIR (attribute index auto-increments), at most 255 bytes per
+// OTIR.
+void sprites_flush(void) {
+    uint8_t *src;
+    uint16_t count;
+
+    // New frame for the pattern cache
+    pattern_clock++;
+    pattern_uploads_left = SPRITE_UPLOADS_PER_FRAME;
+
+    if (sprite_dirty_hi <= sprite_dirty_lo) return;
+
+    src = sprite_attrs + sprite_dirty_lo * SPRITE_ATTR_SIZE;
+    count = (sprite_dirty_hi - sprite_dirty_lo) * SPRITE_ATTR_SIZE;
+
+    z80_outp(SPRITE_SLOT_PORT, sprite_dirty_lo);
+
+    while (count > 255) {
+        src = z80_otir(src, SPRITE_ATTR_PORT, 255);
+        count -= 255;
+    }
+    z80_otir(src, SPRITE_ATTR_PORT, (uint8_t)count);
+
+    sprite_dirty_lo = SPRITE_MAX_SLOTS;
+    sprite_dirty_hi = 0;
 }
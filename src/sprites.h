@@ -6,13 +6,68 @@
 // Initialize sprite system (palette + patterns)
 void sprites_init(void);
 
-// Upload sprite patterns to pattern memory
+// Reset the pattern cache and preload patterns
+// Sprite patterns are referenced by ID (spriteset.h) and uploaded from
+// banked memory to a free hardware slot on first use (LRU eviction,
+// limited uploads per frame).
 void sprites_upload_patterns(void);
 
-// Set sprite attributes
+// Hardware sprite slots
+#define SPRITE_MAX_SLOTS  128
+
+// Sprite attributes are kept in a RAM mirror; sprite_set/sprite_hide
+// only update the mirror and sprites_flush() uploads the changed slots
+// in one burst.
+
+// Set sprite attributes (pattern is a pattern ID)
 void sprite_set(uint8_t slot, int16_t x, int16_t y, uint8_t pattern);
 
+// Attribute flags (byte 2): palette offset and mirror/rotate
+// With 4-bit patterns the palette offset selects 16 colours
+// (offset * 16 + pixel), so one pattern can be drawn in several colourings.
+#define SPRITE_PALETTE(n)   ((n) << 4)
+#define SPRITE_MIRROR_X     0x08
+#define SPRITE_MIRROR_Y     0x04
+#define SPRITE_ROTATE       0x02
+
+// Set sprite attributes with flags
+void sprite_set_flags(uint8_t slot, int16_t x, int16_t y, uint8_t pattern, uint8_t flags);
+
+// Hardware scaling (attribute byte 4): 0 = 1x, 1 = 2x, 2 = 4x, 3 = 8x
+// A scaled sprite still has its top-left corner at x, y
+#define SPRITE_SCALE(sx, sy)  (((sx) << 3) | ((sy) << 1))
+
+// Set sprite attributes with flags and hardware scaling
+void sprite_set_scaled(uint8_t slot, int16_t x, int16_t y, uint8_t pattern,
+                       uint8_t flags, uint8_t scale);
+
+// Set a relative sprite: positioned at dx, dy from the anchor in the
+// slot before it (or the last anchor before a run of relatives)
+void sprite_set_relative(uint8_t slot, int8_t dx, int8_t dy, uint8_t pattern, uint8_t flags);
+
 // Hide a sprite
 void sprite_hide(uint8_t slot);
 
+// Hide all slots from first upwards (only those still visible)
+void sprites_hide_from(uint8_t first);
+
+// Slot allocator
+// The 128 slots are split into priority bands; higher slots are drawn on
+// top, so ground objects stay below ships and effects above everything.
+#define SPRITE_BAND_GROUND   0   // Slots 0-15: ground objects
+#define SPRITE_BAND_AIR      1   // Slots 16-95: ships (shadow + ship pairs), bullets
+#define SPRITE_BAND_SHOTS    2   // Slots 96-111: enemy shots (above ships)
+#define SPRITE_BAND_EFFECTS  3   // Slots 112-127: explosions, pop-ups
+#define SPRITE_BAND_COUNT    4
+#define SPRITE_SLOT_NONE     0xFF
+
+// Allocate count consecutive slots (returns first or SPRITE_SLOT_NONE)
+uint8_t sprite_alloc(uint8_t band, uint8_t count);
+
+// Hide and release allocated slots (SPRITE_SLOT_NONE is ignored)
+void sprite_free(uint8_t first, uint8_t count);
+
+// Upload changed attributes to the hardware (call right after vblank)
+void sprites_flush(void);
+
 #endif // SPRITES_H
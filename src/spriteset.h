@@ -3,344 +3,41 @@
 
 #include <stdint.h>
 
-// Sprite definitions (16x16, 8-bit per pixel)
-// 256 bytes per sprite, 0xE3 = transparent
-// Palette: ZX Spectrum colors 0-15
-
-#define SPRITE_SIZE 256
+// Sprite definitions (16x16, 4-bit per pixel)
+// 128 bytes per sprite, 2 pixels per byte (high nibble = left pixel)
+// Palette: ZX Spectrum colors 0-15 plus the attribute palette offset,
+// nibble 0x0B (bright magenta) = transparent
+// Pattern data lives in banked pages (sprite_patterns.asm), 64 per page
+// from SPRITESET_PAGE, and is uploaded on demand by the pattern cache.
+
+#define SPRITE_SIZE 128
+#define SPRITESET_4BIT 1
 #define SPRITESET_WIDTH 8
 #define SPRITESET_HEIGHT 2
-#define SPRITE_TRANSPARENT 0xE3
-
-// Sprite at (A,0)
-static const uint8_t sprite_A0[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0x0A,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,
-    0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,
-    0xE3,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0x0A,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (B,0)
-static const uint8_t sprite_B0[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0xE3,0xE3,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0x0A,0x0A,0x0A,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0x0A,0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (C,0)
-static const uint8_t sprite_C0[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0xE3,0xE3,0x0F,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (D,0)
-static const uint8_t sprite_D0[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0x0A,0xE3,0x0A,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,
-    0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0x0A,0xE3,0x0A,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (E,0)
-static const uint8_t sprite_E0[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0x0F,0xE3,0xE3,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (F,0)
-static const uint8_t sprite_F0[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0x0F,0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0x0A,0x0A,0x0A,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0xE3,0xE3,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (G,0)
-static const uint8_t sprite_G0[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0x0A,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,
-    0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,
-    0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,
-    0xE3,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0x0A,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0x0A,0xE3,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0xE3,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (H,0)
-static const uint8_t sprite_H0[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,0x0F,0x00,0x0F,0xE3,0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0xE3,0xE3,0x0F,0x00,0x0F,0x00,0x0F,0xE3,0xE3,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0xE3,0x0F,0x0F,0x00,0x0F,0x0F,0xE3,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0F,0x0F,0x0F,0x00,0x0F,0x0F,0x0F,0x00,0x0F,0x0F,0x0F,0xE3,0xE3,0xE3,
-    0xE3,0x0F,0x0F,0x0F,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x0F,0x0F,0x0F,0xE3,0xE3,
-    0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x0F,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xE3,
-    0xE3,0xE3,0xE3,0x00,0x0F,0x00,0x0F,0x00,0x0F,0x00,0x0F,0x00,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x00,0x0F,0x00,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x00,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (A,1)
-static const uint8_t sprite_A1[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x01,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0x01,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x01,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0x01,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,
-    0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,
-    0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,
-    0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (B,1)
-static const uint8_t sprite_B1[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,0xE3,0x0E,0xE3,0xE3,0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0A,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0x0E,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x0E,0xE3,0xE3,0xE3
-};
-
-// Sprite at (C,1)
-static const uint8_t sprite_C1[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,
-    0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,
-    0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,
-    0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,
-    0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0x01,0xE3,0x01,0xE3,0x01,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (D,1)
-static const uint8_t sprite_D1[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (E,1)
-static const uint8_t sprite_E1[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (F,1)
-static const uint8_t sprite_F1[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (G,1)
-static const uint8_t sprite_G1[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Sprite at (H,1)
-static const uint8_t sprite_H1[256] = {
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,
-    0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3
-};
-
-// Array of all sprites for indexed access
-static const uint8_t * const spriteset[16] = {
-    sprite_A0, sprite_B0, sprite_C0, sprite_D0, 
-    sprite_E0, sprite_F0, sprite_G0, sprite_H0, 
-    sprite_A1, sprite_B1, sprite_C1, sprite_D1, 
-    sprite_E1, sprite_F1, sprite_G1, sprite_H1 
-};
-
-// Get sprite by grid position (col=A-P as 0-15, row=0-15)
-#define SPRITESET_AT(col, row) spriteset[(row) * SPRITESET_WIDTH + (col)]
+#define SPRITESET_COUNT 16
+#define SPRITESET_PAGE 44
+#define SPRITES_PER_PAGE 64
+#define SPRITE_TRANSPARENT 0x0B
+
+// Pattern IDs
+#define SPRITE_ID_A0 0
+#define SPRITE_ID_B0 1
+#define SPRITE_ID_C0 2
+#define SPRITE_ID_D0 3
+#define SPRITE_ID_E0 4
+#define SPRITE_ID_F0 5
+#define SPRITE_ID_G0 6
+#define SPRITE_ID_H0 7
+#define SPRITE_ID_A1 8
+#define SPRITE_ID_B1 9
+#define SPRITE_ID_C1 10
+#define SPRITE_ID_D1 11
+#define SPRITE_ID_E1 12
+#define SPRITE_ID_F1 13
+#define SPRITE_ID_G1 14
+#define SPRITE_ID_H1 15
+
+// Get sprite ID by grid position (col=A-P as 0-15, row=0-15)
+#define SPRITESET_ID(col, row) ((row) * SPRITESET_WIDTH + (col))
 
 #endif
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+Bake enemy flight paths into delta-encoded streams in banked memory.
+Usage: python3 bake_paths.py <paths.txt> [page]
+
+  paths.txt - one path per line: name frames x0,y0 x1,y1 x2,y2 x3,y3 ...
+              (chained cubic beziers, pixels relative to the spawn point)
+  page      - 8K page for the path data (default 46)
+
+Creates src/enemy_paths.h (path IDs, offsets, lengths, x extents) and
+src/enemy_paths.asm (one byte per frame: high nibble dx, low nibble dy,
+signed -8..+7 pixels). Each path is resampled to constant speed, and the
+deltas are taken between rounded positions so the stream never drifts.
+"""
+
+import sys
+import os
+
+PAGE_SIZE = 8192
+SAMPLES_PER_SEGMENT = 256
+MAX_DELTA = 7
+
+
+def bezier(p0, p1, p2, p3, t):
+    """Point on a cubic bezier"""
+    u = 1.0 - t
+    a, b, c, d = u * u * u, 3 * u * u * t, 3 * u * t * t, t * t * t
+    return (a * p0[0] + b * p1[0] + c * p2[0] + d * p3[0],
+            a * p0[1] + b * p1[1] + c * p2[1] + d * p3[1])
+
+
+def parse_paths(path):
+    """Read (name, frames, points) entries, skipping comments"""
+    paths = []
+    with open(path) as f:
+        for line_no, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            fields = line.split()
+            name, frames = fields[0], int(fields[1])
+            points = [tuple(float(v) for v in p.split(',')) for p in fields[2:]]
+            if len(points) < 4 or (len(points) - 1) % 3 != 0:
+                raise ValueError(f'{path}:{line_no}: {name} needs 1 + 3n points')
+            if not 0 < frames < 256:
+                raise ValueError(f'{path}:{line_no}: {name} frames must be 1-255')
+            paths.append((name, frames, points))
+    return paths
+
+
+def sample_path(points, frames):
+    """Resample the bezier chain to frames + 1 points at equal arc length"""
+    dense = [points[0]]
+    for seg in range(0, len(points) - 1, 3):
+        p0, p1, p2, p3 = points[seg:seg + 4]
+        for s in range(1, SAMPLES_PER_SEGMENT + 1):
+            dense.append(bezier(p0, p1, p2, p3, s / SAMPLES_PER_SEGMENT))
+
+    lengths = [0.0]
+    for (x0, y0), (x1, y1) in zip(dense, dense[1:]):
+        lengths.append(lengths[-1] + ((x1 - x0) ** 2 + (y1 - y0) ** 2) ** 0.5)
+
+    result = []
+    j = 0
+    for f in range(frames + 1):
+        target = lengths[-1] * f / frames
+        while j < len(lengths) - 2 and lengths[j + 1] < target:
+            j += 1
+        span = lengths[j + 1] - lengths[j]
+        t = (target - lengths[j]) / span if span > 0 else 0.0
+        (x0, y0), (x1, y1) = dense[j], dense[j + 1]
+        result.append((x0 + (x1 - x0) * t, y0 + (y1 - y0) * t))
+    return result
+
+
+def encode_deltas(name, samples):
+    """Delta bytes between rounded positions (dx high nibble, dy low)"""
+    data = []
+    px, py = round(samples[0][0]), round(samples[0][1])
+    for x, y in samples[1:]:
+        nx, ny = round(x), round(y)
+        dx, dy = nx - px, ny - py
+        if max(abs(dx), abs(dy)) > MAX_DELTA:
+            raise ValueError(f'{name}: {dx},{dy} pixels in one frame, use more frames')
+        data.append(((dx & 0x0F) << 4) | (dy & 0x0F))
+        px, py = nx, ny
+    return data
+
+
+def bake(paths_file, page, header_path, asm_path):
+    baked = []
+    offset = 0
+    for name, frames, points in parse_paths(paths_file):
+        samples = sample_path(points, frames)
+        data = encode_deltas(name, samples)
+        xs = [round(x) for x, _ in samples]
+        baked.append((name, offset, data, min(xs), max(xs)))
+        offset += len(data)
+
+    if offset > PAGE_SIZE:
+        raise ValueError(f'{offset} bytes of path data do not fit in one page')
+
+    ids = ''.join(f'#define PATH_{name.upper()} {i}\n' for i, (name, *_) in enumerate(baked))
+    header = f'''#ifndef ENEMY_PATHS_H
+#define ENEMY_PATHS_H
+
+// Enemy flight paths (generated by tools/bake_paths.py from art/paths.txt)
+// Delta streams live in page ENEMY_PATHS_PAGE (enemy_paths.asm), one byte
+// per frame: high nibble dx, low nibble dy, signed pixels.
+// Paths are drawn for enemies entering on the left; negate dx to mirror.
+
+#define ENEMY_PATHS_PAGE {page}
+#define ENEMY_PATH_COUNT {len(baked)}
+
+// Path IDs
+{ids}
+// Per path: byte offset in the page, length in frames, x extent
+#define ENEMY_PATH_OFFSETS {{ {', '.join(str(b[1]) for b in baked)} }}
+#define ENEMY_PATH_FRAMES  {{ {', '.join(str(len(b[2])) for b in baked)} }}
+#define ENEMY_PATH_MIN_X   {{ {', '.join(str(b[3]) for b in baked)} }}
+#define ENEMY_PATH_MAX_X   {{ {', '.join(str(b[4]) for b in baked)} }}
+
+#endif
+'''
+    with open(header_path, 'w') as f:
+        f.write(header)
+
+    asm = f'; Generated from {os.path.basename(paths_file)}: {len(baked)} paths, {offset} bytes\n'
+    asm += f'; Page: {page}\n'
+    asm += f'\nSECTION PAGE_{page}\n'
+    asm += f'PUBLIC _enemy_paths_page{page}\n'
+    asm += f'_enemy_paths_page{page}:\n'
+    for name, _, data, _, _ in baked:
+        asm += f'    ; {name} ({len(data)} frames)\n'
+        for row in range(0, len(data), 16):
+            asm += '    defb ' + ', '.join(f'0x{v:02x}' for v in data[row:row + 16]) + '\n'
+    with open(asm_path, 'w') as f:
+        f.write(asm)
+
+    print(f'Generated {header_path} and {asm_path}')
+    for name, off, data, min_x, max_x in baked:
+        print(f'  {name}: {len(data)} frames at offset {off}, x {min_x}..{max_x}')
+    print(f'  Size: {offset} bytes in page {page}')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    src_dir = os.path.join(os.path.dirname(script_dir), 'src')
+    page = int(sys.argv[2]) if len(sys.argv) > 2 else 46
+
+    bake(sys.argv[1], page,
+         os.path.join(src_dir, 'enemy_paths.h'),
+         os.path.join(src_dir, 'enemy_paths.asm'))
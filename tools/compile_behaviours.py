@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Compile enemy behaviour scripts into bytecode.
+Usage: python3 compile_behaviours.py <behaviours.txt>
+
+Creates src/behaviour_code.h with the bytecode array and one
+BEHAVIOUR_<NAME> entry offset per script. Opcode values are read from
+src/behaviour.h and path names from src/enemy_paths.h, so the compiler
+always matches the VM.
+"""
+
+import re
+import sys
+import os
+
+# Operand kinds per instruction: b = signed/unsigned byte, a = address,
+# p = path name
+OPERANDS = {
+    'end': '', 'move': 'bb', 'wait': 'b', 'path': 'p', 'jump': 'a',
+    'loop': 'b', 'next': 'a', 'fire': '', 'ifleft': 'a', 'ifnear': 'ba',
+    'bounce': '', 'seek': 'b',
+}
+
+MAX_CODE = 255  # pc is one byte, 0xFF marks a finished script
+
+
+def read_defines(path, prefix):
+    """name -> value for '#define <prefix><NAME> <value>' lines"""
+    values = {}
+    pattern = re.compile(r'#define\s+' + prefix + r'(\w+)\s+(0x[0-9A-Fa-f]+|\d+)')
+    with open(path) as f:
+        for line in f:
+            m = pattern.match(line)
+            if m:
+                values[m.group(1).lower()] = int(m.group(2), 0)
+    return values
+
+
+def byte(value, where):
+    value = int(value, 0)
+    if not -128 <= value <= 255:
+        raise ValueError(f'{where}: {value} does not fit in a byte')
+    return value & 0xFF
+
+
+def compile_scripts(source, opcodes, paths):
+    """Two passes: collect labels and sizes, then emit bytes"""
+    lines = []
+    with open(source) as f:
+        for line_no, line in enumerate(f, 1):
+            line = line.split(';', 1)[0].strip()
+            if line:
+                lines.append((f'{source}:{line_no}', line.lower().split()))
+
+    labels, entries, pc = {}, [], 0
+    for where, words in lines:
+        if words[0] == 'behaviour':
+            entries.append((words[1], pc))
+            labels[words[1]] = pc
+        elif words[0].endswith(':'):
+            labels[words[0][:-1]] = pc
+        elif words[0] in OPERANDS:
+            pc += 1 + len(OPERANDS[words[0]])
+        else:
+            raise ValueError(f'{where}: unknown instruction {words[0]}')
+
+    if pc > MAX_CODE:
+        raise ValueError(f'{pc} bytes of bytecode, at most {MAX_CODE}')
+
+    code, listing = [], []
+    for where, words in lines:
+        if words[0] == 'behaviour' or words[0].endswith(':'):
+            listing.append((len(code), None, ' '.join(words)))
+            continue
+        kinds = OPERANDS[words[0]]
+        if len(words) - 1 != len(kinds):
+            raise ValueError(f'{where}: {words[0]} takes {len(kinds)} operands')
+        start = len(code)
+        code.append(opcodes[words[0]])
+        for kind, word in zip(kinds, words[1:]):
+            if kind == 'a':
+                if word not in labels:
+                    raise ValueError(f'{where}: unknown label {word}')
+                code.append(labels[word])
+            elif kind == 'p':
+                if word not in paths:
+                    raise ValueError(f'{where}: unknown path {word}')
+                code.append(paths[word])
+            else:
+                code.append(byte(word, where))
+        listing.append((start, code[start:], ' '.join(words)))
+
+    return code, entries, listing
+
+
+def write_header(path, code, entries, listing):
+    out = '''#ifndef BEHAVIOUR_CODE_H
+#define BEHAVIOUR_CODE_H
+
+#include <stdint.h>
+#include "behaviour.h"
+
+// Enemy behaviour bytecode (generated by tools/compile_behaviours.py
+// from art/behaviours.txt)
+
+// Script entry points
+'''
+    for name, pc in entries:
+        out += f'#define BEHAVIOUR_{name.upper()} {pc}\n'
+
+    out += f'\nstatic const uint8_t behaviour_code[{len(code)}] = {{\n'
+    for pc, data, text in listing:
+        if data is None:
+            out += f'    // {text}\n'
+        else:
+            values = ''.join(f'0x{v:02x}, ' for v in data)
+            out += f'    {values:<24}// {pc:3d}: {text}\n'
+    out += '};\n\n#endif\n'
+
+    with open(path, 'w') as f:
+        f.write(out)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    src_dir = os.path.join(os.path.dirname(script_dir), 'src')
+    header_path = os.path.join(src_dir, 'behaviour_code.h')
+
+    opcodes = read_defines(os.path.join(src_dir, 'behaviour.h'), 'OP_')
+    paths = read_defines(os.path.join(src_dir, 'enemy_paths.h'), 'PATH_')
+
+    code, entries, listing = compile_scripts(sys.argv[1], opcodes, paths)
+    write_header(header_path, code, entries, listing)
+
+    print(f'Generated {header_path}')
+    print(f'  Behaviours: {", ".join(name for name, _ in entries)}')
+    print(f'  Size: {len(code)} bytes')
@@ -3,15 +3,43 @@
 Convert PNG image to z88dk assembly file with banked data.
 
 Usage:
-    python3 png_to_asm.py <input.png> <start_page> [output.asm]
+    python3 png_to_asm.py <input.png> <start_page> [output.asm] [--background|--blocks] [--lz]
 
 Example:
     python3 png_to_asm.py border.png 40 src/border_data.asm
+    python3 png_to_asm.py border.png 16 src/layer2_background.asm --background
+    python3 png_to_asm.py border.png 40 src/border_blocks.asm --blocks
+    python3 png_to_asm.py border.png 42 src/layer2_background_lz.asm --background --lz
+    python3 png_to_asm.py title.png 42 src/title_lz.asm --lz
 
 Requirements:
 - Image height must be exactly 192 pixels
 - Image width can be 1-256 pixels
 - Image is converted to RGB332 format
+
+--background composes the full 256x192 Layer 2 screen offline: black fill,
+image on the left edge and its mirror on the right edge. Uncompressed
+output goes to pages 16-21 so the NEX loader places it straight into the
+Layer 2 banks; with --lz it is packed for layer2_draw_lz_image instead.
+
+--blocks cuts the image into 8x8 blocks (width padded to a multiple of 8),
+dedupes them including X-mirrored variants and emits a single page:
+    byte 0       columns (blocks)
+    byte 1       rows (blocks)
+    byte 2       dictionary block count
+    byte 3       reserved (0)
+    map          columns*rows entries: bit 7 = X mirror, bits 6-0 = block
+    dictionary   64 bytes per block, RGB332
+
+--lz compresses a 256 pixel wide image (or the --background screen) for
+layer2_draw_lz_image. Each 32-line Layer 2 bank (8K) is an independent
+LZ4-style stream, so matches never reach into another bank:
+    byte 0       chunk count (one per Layer 2 bank, starting at bank 16)
+    3 bytes      per chunk: source page, offset low, offset high
+    streams      packed into pages; a stream never straddles a page
+Stream: token (high nibble literals, low nibble match length - 4, 15 =
+extended by following bytes while 255), literals, 16-bit offset (0 = end),
+extended match length.
 """
 
 import sys
@@ -58,6 +86,238 @@ def png_to_rgb332(png_path):
     return pixels, width, height
 
 
+# Layer 2 screen (256x192 mode) and background fill colour
+LAYER2_WIDTH = 256
+LAYER2_HEIGHT = 192
+LAYER2_FILL = 0x00
+
+
+def compose_background(pixels, width, height):
+    """Compose the full Layer 2 screen: image left, mirrored image right."""
+    screen = [LAYER2_FILL] * (LAYER2_WIDTH * LAYER2_HEIGHT)
+    right_x = LAYER2_WIDTH - width
+
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        base = y * LAYER2_WIDTH
+        screen[base:base + width] = row
+        screen[base + right_x:base + LAYER2_WIDTH] = row[::-1]
+
+    print(f"Background: {LAYER2_WIDTH}x{LAYER2_HEIGHT} (image + mirror at x={right_x})")
+
+    return screen, LAYER2_WIDTH, LAYER2_HEIGHT
+
+
+# Block dictionary format
+BLOCK_SIZE = 8
+BLOCK_MIRROR = 0x80
+MAX_BLOCKS = 128
+
+
+def image_to_blocks(pixels, width, height):
+    """Cut image into deduplicated 8x8 blocks. Returns header + map + dictionary."""
+    if height % BLOCK_SIZE != 0:
+        print(f"Error: Image height must be a multiple of {BLOCK_SIZE}")
+        sys.exit(1)
+
+    cols = (width + BLOCK_SIZE - 1) // BLOCK_SIZE
+    rows = height // BLOCK_SIZE
+
+    lookup = {}   # block bytes -> dictionary index
+    blocks = []
+    block_map = []
+
+    for by in range(rows):
+        for bx in range(cols):
+            block = []
+            for y in range(BLOCK_SIZE):
+                for x in range(BLOCK_SIZE):
+                    px = bx * BLOCK_SIZE + x
+                    block.append(pixels[(by * BLOCK_SIZE + y) * width + px] if px < width else LAYER2_FILL)
+            block = tuple(block)
+            mirrored = tuple(block[y * BLOCK_SIZE + BLOCK_SIZE - 1 - x]
+                             for y in range(BLOCK_SIZE) for x in range(BLOCK_SIZE))
+
+            if block in lookup:
+                block_map.append(lookup[block])
+            elif mirrored in lookup:
+                block_map.append(lookup[mirrored] | BLOCK_MIRROR)
+            else:
+                lookup[block] = len(blocks)
+                blocks.append(block)
+                block_map.append(lookup[block])
+
+    if len(blocks) > MAX_BLOCKS:
+        print(f"Error: {len(blocks)} unique blocks, format allows {MAX_BLOCKS}")
+        sys.exit(1)
+
+    data = [cols, rows, len(blocks), 0] + block_map
+    for block in blocks:
+        data.extend(block)
+
+    if len(data) > 8192:
+        print(f"Error: Block data is {len(data)} bytes, must fit in one 8K page")
+        sys.exit(1)
+
+    print(f"Blocks: {cols}x{rows} map, {len(blocks)} unique, {len(data)} bytes "
+          f"(raw {width * height})")
+
+    return data
+
+
+# LZ stream format
+LZ_MIN_MATCH = 4
+LZ_CHUNK_SIZE = 8192
+LZ_MAX_CHAIN = 64
+
+
+def lz_write_length(out, length):
+    """Write extension bytes for a length whose nibble is 15."""
+    length -= 15
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def lz_compress(data):
+    """Greedy LZ4-style compressor with hash chains. Ends with offset 0."""
+    out = []
+    heads = {}
+    chain = [-1] * len(data)
+    pos = 0
+    literal_start = 0
+
+    def insert(p):
+        if p + LZ_MIN_MATCH <= len(data):
+            key = bytes(data[p:p + LZ_MIN_MATCH])
+            chain[p] = heads.get(key, -1)
+            heads[key] = p
+
+    def emit(literals, offset, match_len):
+        lit_len = len(literals)
+        lit_nib = min(lit_len, 15)
+        match_nib = min(match_len - LZ_MIN_MATCH, 15) if offset else 0
+        out.append((lit_nib << 4) | match_nib)
+        if lit_nib == 15:
+            lz_write_length(out, lit_len)
+        out.extend(literals)
+        out.append(offset & 0xFF)
+        out.append(offset >> 8)
+        if offset and match_nib == 15:
+            lz_write_length(out, match_len - LZ_MIN_MATCH)
+
+    while pos < len(data):
+        best_len = 0
+        best_off = 0
+        if pos + LZ_MIN_MATCH <= len(data):
+            cand = heads.get(bytes(data[pos:pos + LZ_MIN_MATCH]), -1)
+            depth = 0
+            while cand >= 0 and depth < LZ_MAX_CHAIN:
+                length = 0
+                while pos + length < len(data) and data[cand + length] == data[pos + length]:
+                    length += 1
+                if length > best_len:
+                    best_len = length
+                    best_off = pos - cand
+                cand = chain[cand]
+                depth += 1
+
+        if best_len >= LZ_MIN_MATCH:
+            emit(data[literal_start:pos], best_off, best_len)
+            for p in range(pos, pos + best_len):
+                insert(p)
+            pos += best_len
+            literal_start = pos
+        else:
+            insert(pos)
+            pos += 1
+
+    # Final literals and end marker
+    emit(data[literal_start:], 0, 0)
+    return out
+
+
+def lz_decompress(src):
+    """Reference decoder, mirrors lz_unpack.asm. Used to verify output."""
+    out = []
+    i = 0
+
+    def read_length(n):
+        nonlocal i
+        if n == 15:
+            while True:
+                b = src[i]
+                i += 1
+                n += b
+                if b != 255:
+                    break
+        return n
+
+    while True:
+        token = src[i]
+        i += 1
+        lit_len = read_length(token >> 4)
+        out.extend(src[i:i + lit_len])
+        i += lit_len
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        if offset == 0:
+            return out
+        match_len = read_length(token & 0x0F) + LZ_MIN_MATCH
+        for _ in range(match_len):
+            out.append(out[-offset])
+
+
+def image_to_lz(pixels, width, height):
+    """Compress a 256 wide image into per-bank LZ chunks with a directory."""
+    if width != LAYER2_WIDTH:
+        print(f"Error: LZ images must be {LAYER2_WIDTH} pixels wide (use --background for narrow art)")
+        sys.exit(1)
+
+    chunks = []
+    for start in range(0, len(pixels), LZ_CHUNK_SIZE):
+        raw = pixels[start:start + LZ_CHUNK_SIZE]
+        packed = lz_compress(raw)
+        if lz_decompress(packed) != list(raw):
+            print("Error: LZ round trip failed")
+            sys.exit(1)
+        if len(packed) > LZ_CHUNK_SIZE:
+            print(f"Error: Chunk {len(chunks)} does not compress below 8K")
+            sys.exit(1)
+        chunks.append(packed)
+
+    # Lay out streams after the directory; never straddle a page
+    pages = [[0] * (1 + 3 * len(chunks))]
+    directory = [len(chunks)]
+    for packed in chunks:
+        if len(pages[-1]) + len(packed) > LZ_CHUNK_SIZE:
+            pages.append([])
+        directory += [len(pages) - 1, len(pages[-1]) & 0xFF, len(pages[-1]) >> 8]
+        pages[-1].extend(packed)
+    pages[0][:len(directory)] = directory
+
+    packed_size = sum(len(c) for c in chunks)
+    print(f"LZ: {len(chunks)} chunks, {packed_size} bytes (raw {len(pixels)}, "
+          f"{100 * packed_size // len(pixels)}%)")
+
+    return pages
+
+
+def lz_pages_to_bytes(pages, start_page):
+    """Make directory pages absolute and pad pages so each starts on 8K."""
+    count = pages[0][0]
+    for i in range(count):
+        pages[0][1 + 3 * i] += start_page
+
+    data = []
+    for i, page in enumerate(pages):
+        data.extend(page)
+        if i < len(pages) - 1:
+            data.extend([0] * (LZ_CHUNK_SIZE - len(page)))
+    return data
+
+
 def generate_asm(pixels, width, height, start_page, label_base):
     """Generate assembly file content with PAGE sections."""
     total_bytes = len(pixels)
@@ -98,21 +358,35 @@ def generate_asm(pixels, width, height, start_page, label_base):
 
 
 def main():
-    if len(sys.argv) < 3:
-        print("Usage: python3 png_to_asm.py <input.png> <start_page> [output.asm]")
+    args = [a for a in sys.argv[1:] if not a.startswith('--')]
+    background = '--background' in sys.argv[1:]
+    block_mode = '--blocks' in sys.argv[1:]
+    lz_mode = '--lz' in sys.argv[1:]
+
+    if len(args) < 2:
+        print("Usage: python3 png_to_asm.py <input.png> <start_page> [output.asm] [--background|--blocks] [--lz]")
         print("")
         print("Example:")
         print("  python3 png_to_asm.py border.png 40 src/border_data.asm")
+        print("  python3 png_to_asm.py border.png 16 src/layer2_background.asm --background")
+        print("  python3 png_to_asm.py border.png 40 src/border_blocks.asm --blocks")
+        print("  python3 png_to_asm.py title.png 42 src/title_lz.asm --lz")
         sys.exit(1)
 
-    png_path = sys.argv[1]
-    start_page = int(sys.argv[2])
+    png_path = args[0]
+    start_page = int(args[1])
 
     # Derive output path and label from input filename
     base_name = os.path.splitext(os.path.basename(png_path))[0]
-
-    if len(sys.argv) >= 4:
-        output_path = sys.argv[3]
+    if background:
+        base_name = "layer2_bg"
+    elif block_mode:
+        base_name = f"{base_name}_blocks"
+    if lz_mode:
+        base_name = f"{base_name}_lz"
+
+    if len(args) >= 3:
+        output_path = args[2]
     else:
         output_path = f"src/{base_name}_data.asm"
 
@@ -128,8 +402,20 @@ def main():
     # Convert PNG to RGB332
     pixels, width, height = png_to_rgb332(png_path)
 
+    # Compose full Layer 2 screen if requested
+    if background:
+        pixels, width, height = compose_background(pixels, width, height)
+
     # Generate assembly
-    asm_content, num_pages = generate_asm(pixels, width, height, start_page, base_name)
+    if block_mode:
+        asm_content, num_pages = generate_asm(image_to_blocks(pixels, width, height),
+                                              width, height, start_page, base_name)
+    elif lz_mode:
+        asm_content, num_pages = generate_asm(lz_pages_to_bytes(image_to_lz(pixels, width, height),
+                                                                start_page),
+                                              width, height, start_page, base_name)
+    else:
+        asm_content, num_pages = generate_asm(pixels, width, height, start_page, base_name)
 
     # Write output
     with open(output_path, 'w') as f:
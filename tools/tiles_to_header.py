@@ -1,11 +1,15 @@
 #!/usr/bin/env python3
 """
 Convert tileset PNG to C header file.
-Usage: python3 tiles_to_header.py <input.png> <tile|sprite> <rows>
+Usage: python3 tiles_to_header.py <input.png> <tile|sprite|sprite4> <rows> [page]
 
-  sprite - Creates spriteset.h, 16x16, 8-bit per pixel (256 bytes each)
+  sprite - Creates spriteset.h (pattern IDs) and sprite_patterns.asm
+           (16x16, 8-bit per pixel, 256 bytes each, banked from page)
+  sprite4 - Same, 4-bit per pixel (128 bytes each, recoloured at runtime
+           with the sprite palette offset)
   tile   - Creates tileset.h, 8x8, 4-bit packed (32 bytes each)
   rows   - Number of rows to process
+  page   - First 8K page for sprite patterns (default 44)
 """
 
 from PIL import Image
@@ -35,6 +39,9 @@ ZX_PALETTE = {
 # Transparent color for sprites (0xE3 is standard ZX Next transparent)
 SPRITE_TRANSPARENT = 0xE3
 
+# Transparent nibble for 4-bit sprites (bright magenta, register 0x4B)
+SPRITE_TRANSPARENT_4BIT = 0x0B
+
 
 def get_palette_index(rgb, is_sprite=False):
     """Get palette index for RGB color, handling transparency for sprites"""
@@ -43,93 +50,141 @@ def get_palette_index(rgb, is_sprite=False):
     return idx
 
 
-def convert_sprites(input_path, output_path, num_rows):
-    """Convert to 16x16 sprites, 8-bit per pixel (256 bytes each)"""
-    img = Image.open(input_path)
-    img = img.convert('RGBA')  # Keep alpha for transparency detection
-
-    tile_size = 16
-    tiles_x = img.width // tile_size
-    tiles_y = min(num_rows, img.height // tile_size)
-    bytes_per_sprite = 256  # 16x16 = 256 pixels, 1 byte each
+def sprite_pixels(img, tx, ty, tile_size):
+    """Get one 16x16 sprite as a list of 8-bit pixel values"""
+    pixels = []
+    for py in range(tile_size):
+        for px in range(tile_size):
+            rgba = img.getpixel((tx * tile_size + px, ty * tile_size + py))
+            rgb = rgba[:3]
+            alpha = rgba[3] if len(rgba) > 3 else 255
+
+            # Transparent if alpha < 128 or bright magenta (index 11)
+            if alpha < 128:
+                pixel_val = SPRITE_TRANSPARENT
+            else:
+                pixel_val = ZX_PALETTE.get(rgb, 0)
+                # Bright magenta (11) = transparent in sprites
+                if pixel_val == 11:
+                    pixel_val = SPRITE_TRANSPARENT
+            pixels.append(pixel_val)
+    return pixels
+
+
+def pack_sprite_4bit(pixels):
+    """Pack 8-bit sprite pixels to 4-bit (high nibble = left pixel)
+
+    Transparent pixels become SPRITE_TRANSPARENT_4BIT (bright magenta,
+    already reserved as transparent in the 8-bit sprites).
+    """
+    nibbles = [SPRITE_TRANSPARENT_4BIT if v == SPRITE_TRANSPARENT else v & 0x0F
+               for v in pixels]
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def write_sprite_outputs(sprites, tiles_x, tiles_y, header_path, asm_path, start_page,
+                         four_bit=False):
+    """Write spriteset.h (IDs) and sprite_patterns.asm (banked pattern data)
+
+    sprites is a list of (name, pixels) in ID order. Patterns are stored
+    back to back (256 bytes each, or 128 for 4-bit), so ID n is at page
+    start_page + n / per_page, offset (n % per_page) * size.
+    """
+    if four_bit:
+        sprites = [(name, pack_sprite_4bit(pixels)) for name, pixels in sprites]
+    bytes_per_sprite = 128 if four_bit else 256
+    bits = 4 if four_bit else 8
+    transparent = SPRITE_TRANSPARENT_4BIT if four_bit else SPRITE_TRANSPARENT
+    per_page = 8192 // bytes_per_sprite
+    num_pages = (len(sprites) + per_page - 1) // per_page
+    end_page = start_page + num_pages - 1
+
+    if four_bit:
+        comment = '''// Sprite definitions (16x16, 4-bit per pixel)
+// 128 bytes per sprite, 2 pixels per byte (high nibble = left pixel)
+// Palette: ZX Spectrum colors 0-15 plus the attribute palette offset,
+// nibble 0x0B (bright magenta) = transparent'''
+    else:
+        comment = '''// Sprite definitions (16x16, 8-bit per pixel)
+// 256 bytes per sprite, 0xE3 = transparent
+// Palette: ZX Spectrum colors 0-15'''
 
     output = f'''#ifndef SPRITESET_H
 #define SPRITESET_H
 
 #include <stdint.h>
 
-// Sprite definitions (16x16, 8-bit per pixel)
-// 256 bytes per sprite, 0xE3 = transparent
-// Palette: ZX Spectrum colors 0-15
+{comment}
+// Pattern data lives in banked pages (sprite_patterns.asm), {per_page} per page
+// from SPRITESET_PAGE, and is uploaded on demand by the pattern cache.
 
 #define SPRITE_SIZE {bytes_per_sprite}
+#define SPRITESET_4BIT {1 if four_bit else 0}
 #define SPRITESET_WIDTH {tiles_x}
 #define SPRITESET_HEIGHT {tiles_y}
-#define SPRITE_TRANSPARENT 0xE3
+#define SPRITESET_COUNT {len(sprites)}
+#define SPRITESET_PAGE {start_page}
+#define SPRITES_PER_PAGE {per_page}
+#define SPRITE_TRANSPARENT 0x{transparent:02X}
 
+// Pattern IDs
 '''
+    for i, (name, _) in enumerate(sprites):
+        output += f'#define SPRITE_ID_{name[len("sprite_"):]} {i}\n'
 
-    sprite_arrays = []
-    for ty in range(tiles_y):
-        for tx in range(tiles_x):
-            # Format sprite name with column letter and row number
-            col_letter = chr(ord('A') + tx)
-            name = f'sprite_{col_letter}{ty}'
+    output += '''
+// Get sprite ID by grid position (col=A-P as 0-15, row=0-15)
+#define SPRITESET_ID(col, row) ((row) * SPRITESET_WIDTH + (col))
 
-            output += f'// Sprite at ({col_letter},{ty})\n'
-            output += f'static const uint8_t {name}[{bytes_per_sprite}] = {{\n'
+#endif
+'''
 
-            for py in range(tile_size):
-                row_pixels = []
-                for px in range(tile_size):
-                    rgba = img.getpixel((tx * tile_size + px, ty * tile_size + py))
-                    rgb = rgba[:3]
-                    alpha = rgba[3] if len(rgba) > 3 else 255
-
-                    # Transparent if alpha < 128 or bright magenta (index 11)
-                    if alpha < 128:
-                        pixel_val = SPRITE_TRANSPARENT
-                    else:
-                        pixel_val = ZX_PALETTE.get(rgb, 0)
-                        # Bright magenta (11) = transparent in sprites
-                        if pixel_val == 11:
-                            pixel_val = SPRITE_TRANSPARENT
-
-                    row_pixels.append(f'0x{pixel_val:02X}')
-
-                comma = ',' if py < tile_size - 1 else ''
-                output += f'    {",".join(row_pixels)}{comma}\n'
+    with open(header_path, 'w') as f:
+        f.write(output)
 
-            output += '};\n\n'
-            sprite_arrays.append(name)
+    asm = f'; Generated from PNG: {len(sprites)} sprites (16x16, {bits}-bit), {len(sprites) * bytes_per_sprite} bytes\n'
+    asm += f'; Pages: {start_page}-{end_page}\n'
+    for page_idx in range(num_pages):
+        page = start_page + page_idx
+        asm += f'\nSECTION PAGE_{page}\n'
+        asm += f'PUBLIC _sprite_patterns_page{page}\n'
+        asm += f'_sprite_patterns_page{page}:\n'
+        for name, data in sprites[page_idx * per_page:(page_idx + 1) * per_page]:
+            asm += f'    ; {name}\n'
+            for row in range(0, bytes_per_sprite, 16):
+                asm += '    defb ' + ', '.join(f'0x{v:02x}' for v in data[row:row + 16]) + '\n'
 
-    # Generate lookup array
-    output += f'// Array of all sprites for indexed access\n'
-    output += f'static const uint8_t * const spriteset[{len(sprite_arrays)}] = {{\n'
-    for i, name in enumerate(sprite_arrays):
-        comma = ',' if i < len(sprite_arrays) - 1 else ''
-        if i % 4 == 0:
-            output += '    '
-        output += f'{name}{comma} '
-        if (i + 1) % 4 == 0:
-            output += '\n'
-    if len(sprite_arrays) % 4 != 0:
-        output += '\n'
-    output += '};\n\n'
+    with open(asm_path, 'w') as f:
+        f.write(asm)
 
-    output += '''// Get sprite by grid position (col=A-P as 0-15, row=0-15)
-#define SPRITESET_AT(col, row) spriteset[(row) * SPRITESET_WIDTH + (col)]
+    return num_pages
 
-#endif
-'''
 
-    with open(output_path, 'w') as f:
-        f.write(output)
+def convert_sprites(input_path, output_path, asm_path, num_rows, start_page, four_bit=False):
+    """Convert to 16x16 sprites, 8-bit (256 bytes) or 4-bit (128 bytes) per sprite"""
+    img = Image.open(input_path)
+    img = img.convert('RGBA')  # Keep alpha for transparency detection
 
-    print(f'Generated {output_path}')
-    print(f'  Mode: sprite (16x16, 8-bit per pixel)')
-    print(f'  Sprites: {tiles_x}x{tiles_y} = {len(sprite_arrays)}')
-    print(f'  Size: {len(sprite_arrays) * bytes_per_sprite} bytes')
+    tile_size = 16
+    tiles_x = img.width // tile_size
+    tiles_y = min(num_rows, img.height // tile_size)
+    bytes_per_sprite = 128 if four_bit else 256
+
+    sprites = []
+    for ty in range(tiles_y):
+        for tx in range(tiles_x):
+            # Format sprite name with column letter and row number
+            col_letter = chr(ord('A') + tx)
+            name = f'sprite_{col_letter}{ty}'
+            sprites.append((name, sprite_pixels(img, tx, ty, tile_size)))
+
+    num_pages = write_sprite_outputs(sprites, tiles_x, tiles_y, output_path, asm_path,
+                                     start_page, four_bit)
+
+    print(f'Generated {output_path} and {asm_path}')
+    print(f'  Mode: sprite (16x16, {4 if four_bit else 8}-bit per pixel)')
+    print(f'  Sprites: {tiles_x}x{tiles_y} = {len(sprites)}')
+    print(f'  Size: {len(sprites) * bytes_per_sprite} bytes in pages {start_page}-{start_page + num_pages - 1}')
 
 
 def convert_tiles(input_path, output_path, num_rows):
@@ -222,16 +277,19 @@ if __name__ == '__main__':
     mode = sys.argv[2].lower()
     num_rows = int(sys.argv[3])
 
-    if mode not in ('tile', 'sprite'):
-        print(f"Error: mode must be 'tile' or 'sprite', got '{mode}'")
+    if mode not in ('tile', 'sprite', 'sprite4'):
+        print(f"Error: mode must be 'tile', 'sprite' or 'sprite4', got '{mode}'")
         sys.exit(1)
 
     script_dir = os.path.dirname(os.path.abspath(__file__))
     src_dir = os.path.join(os.path.dirname(script_dir), 'src')
 
-    if mode == 'sprite':
+    if mode in ('sprite', 'sprite4'):
         output_path = os.path.join(src_dir, 'spriteset.h')
-        convert_sprites(input_path, output_path, num_rows)
+        asm_path = os.path.join(src_dir, 'sprite_patterns.asm')
+        start_page = int(sys.argv[4]) if len(sys.argv) > 4 else 44
+        convert_sprites(input_path, output_path, asm_path, num_rows, start_page,
+                        mode == 'sprite4')
     else:
         output_path = os.path.join(src_dir, 'tileset.h')
         convert_tiles(input_path, output_path, num_rows)